@@ -18,8 +18,20 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <iomanip>
+#include <functional>
 #include <cassert>
+#include <ctime>
+#include <cstdio>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <random>
 #include "graphviz_shower.h"
+#include "b_plus_tree.h"
+#include "disk_b_plus_tree.h"
+#include "concurrent_b_plus_tree.h"
 using namespace std;
 
 namespace ita
@@ -532,4 +544,327 @@ namespace ita
         //btree.Delete(828);
         btree.Display();
     }
+
+    /// B+
+    void testBPlusTree()
+    {
+        BPlusTree<int, int, 64> small_tree;
+        cout << "ÿ64ֽʱҶӽ" << small_tree.LeafCapacity << "ڲ" << small_tree.InnerCapacity << endl;
+        for ( int i = 0; i < 40; ++i )
+        {
+            small_tree.Insert( rand() % 100 + 1, i );
+        }
+        small_tree.Display();
+        for ( int i = 1; i <= 100; i += 2 )
+        {
+            small_tree.Delete( i );
+        }
+        small_tree.Display();
+
+        cout << "˳";
+        for ( auto it = small_tree.Begin(); it != small_tree.End(); ++it )
+        {
+            cout << it.Key() << " ";
+        }
+        cout << endl << "";
+        for ( auto it = small_tree.End(); it != small_tree.Begin(); )
+        {
+            --it;
+            cout << it.Key() << " ";
+        }
+        cout << endl << "Χɨ[20, 60)";
+        small_tree.Scan( 20, 60, []( int key, int )
+        {
+            cout << key << " ";
+        } );
+        cout << endl;
+
+        //BTreeȽҵٶ
+        int const n = 200000;
+        vector<int> keys( n );
+        for ( int i = 0; i < n; ++i )
+        {
+            keys[i] = ( rand() % 32768 ) * 32768 + rand() % 32768;
+        }
+
+        BTree btree( 16 );
+        BPlusTree<int, int> bplus_tree;
+        for ( int i = 0; i < n; ++i )
+        {
+            btree.Insert( keys[i] );
+            bplus_tree.Insert( keys[i], i );
+        }
+
+        shuffle( keys.begin(), keys.end(), mt19937( rand() ) );
+        size_t found = 0;
+        clock_t start = clock();
+        for ( int i = 0; i < n; ++i )
+        {
+            found += ( btree.Search( keys[i] ).first != nullptr );
+        }
+        cout << "BTree" << n << "ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "" << endl;
+
+        found = 0;
+        start = clock();
+        for ( int i = 0; i < n; ++i )
+        {
+            found += ( bplus_tree.Search( keys[i] ) != nullptr );
+        }
+        cout << "BPlusTree" << n << "ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "ߣ" << bplus_tree.Height() << endl;
+
+        //ΧѯؼֵһScan
+        int const lo = 1 << 28, hi = lo + ( 1 << 22 );
+        found = 0;
+        start = clock();
+        for ( int key = lo; key < hi; ++key )
+        {
+            found += ( bplus_tree.Search( key ) != nullptr );
+        }
+        cout << "[" << lo << ", " << hi << ")ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "" << endl;
+
+        start = clock();
+        found = bplus_tree.Scan( lo, hi, []( int, int ) {} );
+        cout << "Scan[" << lo << ", " << hi << ")ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "" << endl;
+
+        //뽨ԵϵBulkLoad
+        vector<pair<int, int>> sorted_items;
+        for ( auto it = bplus_tree.Begin(); it != bplus_tree.End(); ++it )
+        {
+            sorted_items.push_back( make_pair( it.Key(), it.Value() ) );
+        }
+
+        BPlusTree<int, int> inserted_tree;
+        start = clock();
+        for ( size_t i = 0; i < sorted_items.size(); ++i )
+        {
+            inserted_tree.Insert( sorted_items[i].first, sorted_items[i].second );
+        }
+        cout << "" << sorted_items.size() << "Ԫʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msߣ" << inserted_tree.Height() << endl;
+
+        BPlusTree<int, int> loaded_tree;
+        start = clock();
+        loaded_tree.BulkLoad( sorted_items.begin(), sorted_items.end(), 0.9 );
+        cout << "BulkLoad" << loaded_tree.Size() << "Ԫʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msߣ" << loaded_tree.Height() << endl;
+
+        //ϲһԪأµĹؼ֣żеĹؼ
+        vector<pair<int, int>> batch;
+        for ( int i = 0; i < static_cast<int>( sorted_items.size() ); ++i )
+        {
+            batch.push_back( make_pair( i % 2 ? i : sorted_items[i].first, -i ) );
+        }
+        sort( batch.begin(), batch.end() );
+        batch.erase( unique( batch.begin(), batch.end(), []( pair<int, int> const &a, pair<int, int> const &b )
+        {
+            return a.first == b.first;
+        } ), batch.end() );
+        start = clock();
+        size_t merged = loaded_tree.Merge( batch.begin(), batch.end(), 0.9 );
+        cout << "ϲ" << batch.size() << "Ԫʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "ms²" << merged << "Ԫظ" << loaded_tree.Size() << endl;
+    }
+
+    /// ҳļеB+
+    void testDiskBPlusTree()
+    {
+        char const *path = "disk_b_plus_tree.index";
+        remove( path );
+
+        int const n = 100000;
+        {
+            DiskBPlusTree<int, int> tree( path );
+            clock_t start = clock();
+            for ( int i = 0; i < n; ++i )
+            {
+                tree.Insert( ( i * 7919 ) % n, i );
+            }
+            for ( int i = 0; i < n; i += 3 )
+            {
+                tree.Delete( i );
+            }
+            cout << "ļʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msԪظ" << tree.Size()
+                 << "ߣ" << tree.Height() << "ҳ" << tree.PageCount() << endl;
+        }	//ʱеҳдļ
+
+        {
+            //´еļҪؽ
+            DiskBPlusTree<int, int> tree( path );
+            cout << "´ļԪظ" << tree.Size() << "ߣ" << tree.Height() << endl;
+            for ( int key = 0; key < 10; ++key )
+            {
+                int value;
+                cout << "ʼ[" << key << "]";
+                if ( tree.Search( key, value ) )
+                {
+                    cout << value << endl;
+                }
+                else
+                {
+                    cout << "δҵ" << endl;
+                }
+            }
+
+            cout << "Χɨ[1000, 1020)";
+            tree.Scan( 1000, 1020, []( int key, int )
+            {
+                cout << key << " ";
+            } );
+            cout << endl;
+        }
+
+        remove( path );
+    }
+
+    /// @brief ֹϵĲB+
+    ///
+    /// ģһд̲߳ϵزɾͬʱɸ̲߳ͣزҡ
+    /// żؼԤȲ벢Զɾ߳ÿζҵǣؼд̲߳ɾ
+    void testConcurrentBPlusTree()
+    {
+        int const n = 100000;
+        int const reader_count = 4;
+        ConcurrentBPlusTree<int, int> tree;
+        cout << "ÿ512ֽʱҶӽ" << tree.LeafCapacity << "ڲ" << tree.InnerCapacity << endl;
+        for ( int i = 0; i < n; i += 2 )
+        {
+            tree.Insert( i, i );
+        }
+
+        atomic<bool> stop( false );
+        atomic<size_t> lookups( 0 ), errors( 0 );
+        vector<thread> readers;
+        for ( int t = 0; t < reader_count; ++t )
+        {
+            readers.push_back( thread( [&, t]()
+            {
+                size_t count = 0;
+                for ( int i = t; !stop; i = ( i + 7919 ) % n )
+                {
+                    int value;
+                    bool found = tree.Search( i, value );
+                    if ( ( i % 2 == 0 && ( !found || value != i ) ) || ( found && value != i ) )
+                    {
+                        ++errors;
+                    }
+                    ++count;
+                }
+                lookups += count;
+            } ) );
+        }
+
+        //д̣߳еؼ֣ɾеһ
+        for ( int i = 1; i < n; i += 2 )
+        {
+            tree.Insert( i, i );
+        }
+        for ( int i = 1; i < n; i += 4 )
+        {
+            tree.Delete( i );
+        }
+        stop = true;
+        for ( size_t t = 0; t < readers.size(); ++t )
+        {
+            readers[t].join();
+        }
+
+        cout << "д߳ʱ̹߳" << lookups << "Σ" << errors << endl;
+        cout << "Ԫظ" << tree.Size() << "ӦΪ" << n / 2 + n / 4 << "ߣ" << tree.Height() << endl;
+        for ( int i = 0; i < 10; ++i )
+        {
+            int value;
+            cout << "ʼ[" << i << "]";
+            if ( tree.Search( i, value ) )
+            {
+                cout << value << endl;
+            }
+            else
+            {
+                cout << "δҵ" << endl;
+            }
+        }
+    }
+
+    /// @brief Ƚϡһȫ + BPlusTreeConcurrentBPlusTreeڶдϸµ
+    ///
+    /// ԤnԪأ164̸ִ߳Ĳ루ĹؼеĹؼֲظ
+    /// дıֱΪ0%5%50%ÿɵĲΣ
+    void ConcurrentBPlusTreeBenchmark()
+    {
+        int const n = 1 << 20;
+        int const total_ops = 1 << 21;
+        int const write_percents[] = { 0, 5, 50 };
+        int const thread_counts[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+        for ( size_t w = 0; w < sizeof( write_percents ) / sizeof( write_percents[0] ); ++w )
+        {
+            int write_percent = write_percents[w];
+            cout << "дռ" << write_percent << "%" << endl;
+            for ( size_t c = 0; c < sizeof( thread_counts ) / sizeof( thread_counts[0] ); ++c )
+            {
+                int thread_count = thread_counts[c];
+                int ops_per_thread = total_ops / thread_count;
+
+                //еĹؼ4ı߳tĹؼģ41һͬ
+                auto run = [&]( function<void ( int, bool )> op ) -> double
+                {
+                    auto start = chrono::steady_clock::now();
+                    vector<thread> threads;
+                    for ( int t = 0; t < thread_count; ++t )
+                    {
+                        threads.push_back( thread( [&, t]()
+                        {
+                            unsigned int seed = 2654435761u * ( t + 1 );
+                            for ( int i = 0; i < ops_per_thread; ++i )
+                            {
+                                seed = seed * 1103515245u + 12345u;
+                                bool is_write = static_cast<int>( ( seed >> 16 ) % 100 ) < write_percent;
+                                int key = is_write ? ( ( t * ops_per_thread + i ) * 4 + 1 ) : static_cast<int>( ( seed >> 4 ) % n ) * 4;
+                                op( key, is_write );
+                            }
+                        } ) );
+                    }
+                    for ( size_t t = 0; t < threads.size(); ++t )
+                    {
+                        threads[t].join();
+                    }
+                    double seconds = chrono::duration<double>( chrono::steady_clock::now() - start ).count();
+                    return total_ops / seconds / 1e6;
+                };
+
+                BPlusTree<int, int> locked_tree;
+                mutex tree_lock;
+                ConcurrentBPlusTree<int, int> olc_tree;
+                for ( int i = 0; i < n; ++i )
+                {
+                    locked_tree.Insert( i * 4, i );
+                    olc_tree.Insert( i * 4, i );
+                }
+
+                double locked = run( [&]( int key, bool is_write )
+                {
+                    lock_guard<mutex> lock( tree_lock );
+                    if ( is_write )
+                    {
+                        locked_tree.Insert( key, key );
+                    }
+                    else
+                    {
+                        locked_tree.Search( key );
+                    }
+                } );
+                double olc = run( [&]( int key, bool is_write )
+                {
+                    int value;
+                    if ( is_write )
+                    {
+                        olc_tree.Insert( key, key );
+                    }
+                    else
+                    {
+                        olc_tree.Search( key, value );
+                    }
+                } );
+                cout << "    " << setw( 2 ) << thread_count << "߳    ȫ" << setw( 8 ) << locked
+                     << "Mops/s    ֹϣ" << setw( 8 ) << olc << "Mops/s" << endl;
+            }
+        }
+    }
 }
\ No newline at end of file
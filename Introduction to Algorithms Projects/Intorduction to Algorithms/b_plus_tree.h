@@ -0,0 +1,857 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		b_plus_tree.h
+/// @brief		С̶ؼŵB+֧뷶Χɨ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <iostream>
+#include <algorithm>
+#include <sstream>
+#include <cstdint>
+#include <cstdlib>
+#include <cassert>
+#include <vector>
+#include <utility>
+#ifdef _MSC_VER
+#include <xmmintrin.h>
+#endif
+#include "node_pool.h"
+#include "graphviz_shower.h"
+using namespace std;
+
+namespace ita
+{
+    /// @brief С̶ؼŵB+
+    ///
+    /// B_tree.cppеBTreeϵBÿvector<int> Keysvector<BTreeNode *> Childs
+    /// һҪζѷ䣬ڵĲ˳ȽϡΪʹʱ󲿷ʱ䶼ɢڶѸĽˡ\n
+    /// BPlusTreeİ汾
+    /// - еֵҶӽУڲֻŷָؼ֣Ҷӽ㰴ؼֵ˳˫ڷΧɨ裻
+    /// - ÿһСΪNodeBytesĬΪ16УĶڴ棬ؼֵָ֡붼ڽе
+    ///   NodeBytes͹ؼֵ֡ĴСڱ
+    /// - NodePoolгɿط䣬ÿֻռһΣ̯ģ䣻鰴ж룬֮ļǡNodeBytes
+    ///   ÿӻеı߽翪ʼǡռNodeBytes / 64У
+    /// - öֲҶλؼ֡
+    ///
+    /// ڲУChildren[i]еĹؼkKeys[i - 1] <= k < Keys[i]\n
+    /// ⣬ÿǰģʹʱѣɾʹ㲻ʱڵֵܽ裬費ֵܺϲ
+    /// ɾֻӸһˣ;¾ڲ㣬ϲ·ϴ˽вҪָ롣
+    /// @param	KeyType		ؼֵͣmemcpyƣ֧<Ƚ
+    /// @param	ValueType	ֵͣmemcpy
+    /// @param	NodeBytes	ÿֽӦΪУ64ֽڣı
+    /// @see	class BTree
+    template<typename KeyType, typename ValueType, size_t NodeBytes = 1024>
+    class BPlusTree
+    {
+    private:
+        /// н㹲еͷ
+        struct _NodeHeader
+        {
+            bool		IsLeaf;		///< ǷΪҶӽ
+            uint16_t	Count;		///< ؼֵĸ
+        };
+
+        struct _LeafNode;
+
+    public:
+        /// ÿҶӽܴŵĹؼֵĸ
+        static size_t const LeafCapacity = ( NodeBytes - sizeof( _NodeHeader ) - 2 * sizeof( void * ) ) / ( sizeof( KeyType ) + sizeof( ValueType ) );
+
+        /// ÿڲܴŵĹؼֵĸӵĸ1
+        static size_t const InnerCapacity = ( NodeBytes - sizeof( _NodeHeader ) - sizeof( void * ) ) / ( sizeof( KeyType ) + sizeof( void * ) );
+
+        static_assert( LeafCapacity >= 3 && InnerCapacity >= 3, "NodeBytes̫СзŲ㹻Ĺؼ" );
+        static_assert( NodeBytes % 64 == 0, "NodeBytesӦΪУ64ֽڣı" );
+
+        /// @brief ؼ˳Ԫص˫
+        ///
+        /// (Ҷӽ, еλ)ҶƶҪصڲ㡣
+        /// @code
+        /// for ( auto it = tree.LowerBound( lo ); it != tree.End() && it.Key() < hi; ++it )
+        /// {
+        ///     //it.Key(), it.Value()
+        /// }
+        /// @endcode
+        /// @note	ɾԪ֮֮ǰõĵʧЧ
+        class Iterator
+        {
+        public:
+            Iterator( _LeafNode *leaf = nullptr, size_t index = 0 ) : _leaf( leaf ), _index( index )
+            {
+
+            }
+
+            KeyType const & Key() const
+            {
+                return _leaf->Keys[_index];
+            }
+
+            ValueType & Value() const
+            {
+                return _leaf->Values[_index];
+            }
+
+            /// ƶһԪأ߹һԪغEnd()
+            Iterator & operator++()
+            {
+                if ( ++_index == _leaf->Count && _leaf->Next )
+                {
+                    _leaf = _leaf->Next;
+                    _index = 0;
+                }
+                return *this;
+            }
+
+            /// ƶһԪأEnd()ǰƶһһԪ
+            Iterator & operator--()
+            {
+                if ( _index == 0 )
+                {
+                    _leaf = _leaf->Prev;
+                    _index = _leaf->Count;
+                }
+                --_index;
+                return *this;
+            }
+
+            bool operator==( Iterator const &other ) const
+            {
+                return _leaf == other._leaf && _index == other._index;
+            }
+
+            bool operator!=( Iterator const &other ) const
+            {
+                return !( *this == other );
+            }
+
+        private:
+            _LeafNode	*_leaf;		///< ǰڵҶӽ
+            size_t		_index;		///< Ҷӽеλ
+        };
+
+        /// һÿյB+һյҶӽ
+        BPlusTree() : _size( 0 ), _height( 1 )
+        {
+            _first_leaf = _last_leaf = _NewLeaf();
+            _root = _first_leaf;
+        }
+
+        /// @brief ҹؼkey
+        ///
+        /// @return	ҵʱֵָ룬򷵻nullptr
+        ValueType * Search( KeyType const &key )
+        {
+            _LeafNode *leaf = _FindLeaf( key );
+            size_t pos = _LowerBound( leaf->Keys, leaf->Count, key );
+            if ( pos < leaf->Count && !( key < leaf->Keys[pos] ) )
+            {
+                return &leaf->Values[pos];
+            }
+            return nullptr;
+        }
+
+        /// @brief һԪ
+        ///
+        /// @return	trueʾµԪأfalseʾؼѾڣֵֻ
+        bool Insert( KeyType const &key, ValueType const &value )
+        {
+            _Path path;
+            _LeafNode *leaf = _FindLeaf( key, &path );
+            size_t pos = _LowerBound( leaf->Keys, leaf->Count, key );
+            if ( pos < leaf->Count && !( key < leaf->Keys[pos] ) )
+            {
+                leaf->Values[pos] = value;
+                return false;
+            }
+
+            ++_size;
+            if ( leaf->Count < LeafCapacity )
+            {
+                _InsertIntoLeaf( leaf, pos, key, value );
+                return true;
+            }
+
+            //ҶһᵽµҶУٰԪز뵽ȥһ
+            _LeafNode *right = _NewLeaf();
+            size_t half = LeafCapacity / 2;
+            right->Count = static_cast<uint16_t>( LeafCapacity - half );
+            copy( leaf->Keys + half, leaf->Keys + LeafCapacity, right->Keys );
+            copy( leaf->Values + half, leaf->Values + LeafCapacity, right->Values );
+            leaf->Count = static_cast<uint16_t>( half );
+
+            right->Next = leaf->Next;
+            right->Prev = leaf;
+            ( leaf->Next ? leaf->Next->Prev : _last_leaf ) = right;
+            leaf->Next = right;
+
+            if ( pos <= half )
+            {
+                _InsertIntoLeaf( leaf, pos, key, value );
+            }
+            else
+            {
+                _InsertIntoLeaf( right, pos - half, key, value );
+            }
+
+            _InsertIntoParent( path, right->Keys[0], right );
+            return true;
+        }
+
+        /// @brief ɾһԪ
+        ///
+        /// @return	ǷɹɾԪ
+        bool Delete( KeyType const &key )
+        {
+            _Path path;
+            _LeafNode *leaf = _FindLeaf( key, &path );
+            size_t pos = _LowerBound( leaf->Keys, leaf->Count, key );
+            if ( pos == leaf->Count || key < leaf->Keys[pos] )
+            {
+                return false;
+            }
+
+            copy( leaf->Keys + pos + 1, leaf->Keys + leaf->Count, leaf->Keys + pos );
+            copy( leaf->Values + pos + 1, leaf->Values + leaf->Count, leaf->Values + pos );
+            --leaf->Count;
+            --_size;
+
+            if ( path.Depth > 0 && leaf->Count < LeafCapacity / 2 )
+            {
+                _RebalanceLeaf( path, leaf );
+            }
+            return true;
+        }
+
+        /// ָؼСԪصĵ
+        Iterator Begin() const
+        {
+            return Iterator( _first_leaf, 0 );
+        }
+
+        /// ָһԪ֮ĵ
+        Iterator End() const
+        {
+            return Iterator( _last_leaf, _last_leaf->Count );
+        }
+
+        /// ָһؼֲСkeyԪصĵʱΪEnd()
+        Iterator LowerBound( KeyType const &key ) const
+        {
+            _LeafNode *leaf = _FindLeaf( key );
+            return _Normalize( leaf, _LowerBound( leaf->Keys, leaf->Count, key ) );
+        }
+
+        /// ָһؼִkeyԪصĵʱΪEnd()
+        Iterator UpperBound( KeyType const &key ) const
+        {
+            _LeafNode *leaf = _FindLeaf( key );
+            return _Normalize( leaf, _UpperBound( leaf->Keys, leaf->Count, key ) );
+        }
+
+        /// ָؼΪkeyԪصĵʱΪEnd()
+        Iterator Find( KeyType const &key ) const
+        {
+            Iterator it = LowerBound( key );
+            return ( it != End() && !( key < it.Key() ) ) ? it : End();
+        }
+
+        /// @brief ؼִС˳򣬶Թؼ[lo, hi)еÿһԪصһcallback( key, value )
+        ///
+        /// ֻӸһҵloڵҶӣ֮Ҷɨ裻ǰҶʱԤȡһҶӣ
+        /// ʹһҶӵڴȡ뵱ǰҶӵĴص
+        /// @return	ʹԪصĸ
+        template<typename Callback>
+        size_t Scan( KeyType const &lo, KeyType const &hi, Callback callback )
+        {
+            size_t visited = 0;
+            _LeafNode *leaf = _FindLeaf( lo );
+            size_t index = _LowerBound( leaf->Keys, leaf->Count, lo );
+            for ( ; leaf; leaf = leaf->Next, index = 0 )
+            {
+                if ( leaf->Next )
+                {
+                    _Prefetch( leaf->Next );
+                    _Prefetch( leaf->Next->Keys );
+                    _Prefetch( leaf->Next->Values );
+                }
+                for ( ; index < leaf->Count; ++index )
+                {
+                    if ( !( leaf->Keys[index] < hi ) )
+                    {
+                        return visited;
+                    }
+                    callback( leaf->Keys[index], leaf->Values[index] );
+                    ++visited;
+                }
+            }
+            return visited;
+        }
+
+        /// @brief ðؼϸԪ[first, last)Եϵؽ
+        ///
+        /// ԭеԪȫҶӽ㰴˳һһװfill_factorȻÿһ㰴ͬװ
+        /// һĽΪڲ㣬ֱֻʣһ㡣ֻ˳ضһ룬O(n)
+        /// һܲʱߵĽϲƽ֡\n
+        /// µȽһУɹ֮ԭ벻ϸʱ׳쳣ԭֲ䡣
+        /// @param	first, last		ԪΪpair<KeyType, ValueType>
+        /// @param	fill_factor		ÿװıȡֵ(0, 1]ʵʻᱻڰȫ֮䡣
+        ///							֮ҪӦһЩλֻװ
+        template<typename InputIterator>
+        void BulkLoad( InputIterator first, InputIterator last, double fill_factor = 1.0 )
+        {
+            BPlusTree scratch;
+            scratch._BulkLoad( first, last, fill_factor );
+            _Swap( scratch );
+        }
+
+        /// @brief ѰؼϸһԪ[first, last)ϲ
+        ///
+        /// ؼѾʱֵһԪСʱ룻ԭеԪһԪع鲢
+        /// һУBulkLoadؽO(n + m)\n
+        /// һ·ȼһԪǷϸʱ׳쳣ֲ䡣
+        /// @return	²Ԫصĸ
+        template<typename InputIterator>
+        size_t Merge( InputIterator first, InputIterator last, double fill_factor = 1.0 )
+        {
+            vector<pair<KeyType, ValueType>> batch( first, last );
+            for ( size_t i = 1; i < batch.size(); ++i )
+            {
+                if ( !( batch[i - 1].first < batch[i].first ) )
+                {
+                    throw exception( "Merge밴ؼϸ" );
+                }
+            }
+
+            size_t inserted = 0;
+            if ( batch.size() * 16 < _size )
+            {
+                for ( size_t i = 0; i < batch.size(); ++i )
+                {
+                    inserted += Insert( batch[i].first, batch[i].second );
+                }
+                return inserted;
+            }
+
+            vector<pair<KeyType, ValueType>> merged;
+            merged.reserve( _size + batch.size() );
+            Iterator it = Begin();
+            size_t i = 0;
+            while ( it != End() || i < batch.size() )
+            {
+                if ( i == batch.size() || ( it != End() && it.Key() < batch[i].first ) )
+                {
+                    merged.push_back( make_pair( it.Key(), it.Value() ) );
+                    ++it;
+                }
+                else
+                {
+                    if ( it != End() && !( batch[i].first < it.Key() ) )
+                    {
+                        ++it;		//ؼѾڣʹµֵ
+                    }
+                    else
+                    {
+                        ++inserted;
+                    }
+                    merged.push_back( batch[i++] );
+                }
+            }
+            BulkLoad( merged.begin(), merged.end(), fill_factor );
+            return inserted;
+        }
+
+        /// ɾеԪأͷеĽ
+        void Clear()
+        {
+            _leaf_pool.Clear();
+            _inner_pool.Clear();
+            _first_leaf = _last_leaf = _NewLeaf();
+            _root = _first_leaf;
+            _size = 0;
+            _height = 1;
+        }
+
+        /// Ԫصĸ
+        size_t Size() const
+        {
+            return _size;
+        }
+
+        /// ĸ߶ȣֻһҶӽʱΪ1
+        size_t Height() const
+        {
+            return _height;
+        }
+
+        /// ʹGraphivizʾǰB+ڲṹ
+        void Display()
+        {
+            stringstream ss;
+
+            ss << "digraph graphname" << ( rand() % 1000 ) << "{" << endl
+               << "    node [shape = record,height = .1];" << endl;
+            _GetDotLanguageViaNodeAndEdge( ss, _root );
+            for ( _LeafNode *leaf = _first_leaf; leaf->Next; leaf = leaf->Next )
+            {
+                ss << "    \"node" << leaf << "\" -> \"node" << leaf->Next << "\" [style = dashed];" << endl;
+            }
+            ss << "}" << endl;
+
+            qi::ShowGraphvizViaDot( ss.str() );
+        }
+
+    private:
+        BPlusTree( BPlusTree const & );
+        BPlusTree & operator=( BPlusTree const & );
+
+        /// Ҷӽ㣺ŹؼֵֺڵҶӽ
+        struct _LeafNode : public _NodeHeader
+        {
+            _LeafNode	*Prev;						///< ڵҶӽ
+            _LeafNode	*Next;						///< ұڵҶӽ
+            KeyType		Keys[LeafCapacity];
+            ValueType	Values[LeafCapacity];
+        };
+
+        /// ڲ㣺ŷָؼֺͺָ
+        struct _InnerNode : public _NodeHeader
+        {
+            KeyType		Keys[InnerCapacity];
+            _NodeHeader	*Children[InnerCapacity + 1];
+        };
+
+        static_assert( sizeof( _LeafNode ) <= NodeBytes && sizeof( _InnerNode ) <= NodeBytes, "㳬NodeBytesļ" );
+
+        /// ӸҶӵ·Ͼڲ㣬Լÿڲ˵ڼ
+        struct _Path
+        {
+            _InnerNode	*Nodes[64];
+            size_t		Slots[64];
+            size_t		Depth;
+
+            _Path() : Depth( 0 ) {}
+        };
+
+        /// keys[0, count)жֲҵһСkeyλ
+        static size_t _LowerBound( KeyType const *keys, size_t count, KeyType const &key )
+        {
+            return lower_bound( keys, keys + count, key ) - keys;
+        }
+
+        /// keys[0, count)жֲҵһkeyλãڲkeyڵĺ
+        static size_t _UpperBound( KeyType const *keys, size_t count, KeyType const &key )
+        {
+            return upper_bound( keys, keys + count, key ) - keys;
+        }
+
+        /// Ҷеλindex߹ҶӵĩβʱΪһҶӵĿͷ
+        Iterator _Normalize( _LeafNode *leaf, size_t index ) const
+        {
+            if ( index == leaf->Count && leaf->Next )
+            {
+                return Iterator( leaf->Next, 0 );
+            }
+            return Iterator( leaf, index );
+        }
+
+        /// ʾCPUaddressڵĻǰ뻺
+        static void _Prefetch( void const *address )
+        {
+#if defined(_MSC_VER)
+            _mm_prefetch( static_cast<char const *>( address ), _MM_HINT_T0 );
+#else
+            __builtin_prefetch( address );
+#endif
+        }
+
+        /// @brief nÿperΪһ飬ÿĴС
+        ///
+        /// һlowʱǰһϲϲ󳬹highƽΪ
+        static vector<size_t> _GroupSizes( size_t n, size_t per, size_t low, size_t high )
+        {
+            vector<size_t> sizes( n / per, per );
+            size_t rest = n % per;
+            if ( rest > 0 )
+            {
+                if ( sizes.empty() || rest >= low )
+                {
+                    sizes.push_back( rest );
+                }
+                else if ( per + rest <= high )
+                {
+                    sizes.back() += rest;
+                }
+                else
+                {
+                    sizes.back() = ( per + rest ) / 2;
+                    sizes.push_back( per + rest - sizes.back() );
+                }
+            }
+            return sizes;
+        }
+
+        /// BulkLoadʵ֣ҪǸչĿֻһյҶӽ㣩
+        template<typename InputIterator>
+        void _BulkLoad( InputIterator first, InputIterator last, double fill_factor )
+        {
+            size_t per_leaf = max( LeafCapacity / 2, min( LeafCapacity, static_cast<size_t>( LeafCapacity * fill_factor ) ) );
+            vector<pair<KeyType, _NodeHeader *>> level;		//<СĹؼ, >
+            _LeafNode *leaf = _first_leaf;
+            for ( ; first != last; ++first )
+            {
+                if ( leaf->Count > 0 && !( leaf->Keys[leaf->Count - 1] < first->first ) )
+                {
+                    throw exception( "BulkLoad밴ؼϸ" );
+                }
+                if ( leaf->Count == per_leaf )
+                {
+                    level.push_back( make_pair( leaf->Keys[0], static_cast<_NodeHeader *>( leaf ) ) );
+                    _LeafNode *next = _NewLeaf();
+                    next->Prev = leaf;
+                    leaf->Next = next;
+                    leaf = next;
+                }
+                leaf->Keys[leaf->Count] = first->first;
+                leaf->Values[leaf->Count] = first->second;
+                ++leaf->Count;
+                ++_size;
+            }
+            _last_leaf = leaf;
+
+            //һҶӲߵҶӺϲϲ¾ƽ
+            _LeafNode *prev = leaf->Prev;
+            if ( prev && leaf->Count < LeafCapacity / 2 )
+            {
+                size_t total = prev->Count + leaf->Count;
+                if ( total <= LeafCapacity )
+                {
+                    copy( leaf->Keys, leaf->Keys + leaf->Count, prev->Keys + prev->Count );
+                    copy( leaf->Values, leaf->Values + leaf->Count, prev->Values + prev->Count );
+                    prev->Count = static_cast<uint16_t>( total );
+                    prev->Next = nullptr;
+                    _last_leaf = prev;
+                    _leaf_pool.Release( leaf );
+                    leaf = nullptr;
+                }
+                else
+                {
+                    size_t borrowed = prev->Count - total / 2;
+                    copy_backward( leaf->Keys, leaf->Keys + leaf->Count, leaf->Keys + leaf->Count + borrowed );
+                    copy_backward( leaf->Values, leaf->Values + leaf->Count, leaf->Values + leaf->Count + borrowed );
+                    copy( prev->Keys + prev->Count - borrowed, prev->Keys + prev->Count, leaf->Keys );
+                    copy( prev->Values + prev->Count - borrowed, prev->Values + prev->Count, leaf->Values );
+                    prev->Count = static_cast<uint16_t>( total / 2 );
+                    leaf->Count = static_cast<uint16_t>( total - total / 2 );
+                }
+            }
+            if ( leaf && leaf->Count > 0 )
+            {
+                level.push_back( make_pair( leaf->Keys[0], static_cast<_NodeHeader *>( leaf ) ) );
+            }
+
+            //Ͻڲ
+            size_t per_inner = max( InnerCapacity / 2 + 1, min( InnerCapacity + 1, static_cast<size_t>( ( InnerCapacity + 1 ) * fill_factor ) ) );
+            while ( level.size() > 1 )
+            {
+                vector<size_t> sizes = _GroupSizes( level.size(), per_inner, InnerCapacity / 2 + 1, InnerCapacity + 1 );
+                vector<pair<KeyType, _NodeHeader *>> upper;
+                size_t k = 0;
+                for ( size_t g = 0; g < sizes.size(); ++g )
+                {
+                    _InnerNode *inner = _NewInner();
+                    upper.push_back( make_pair( level[k].first, static_cast<_NodeHeader *>( inner ) ) );
+                    inner->Children[0] = level[k++].second;
+                    for ( size_t c = 1; c < sizes[g]; ++c, ++k )
+                    {
+                        inner->Keys[c - 1] = level[k].first;
+                        inner->Children[c] = level[k].second;
+                    }
+                    inner->Count = static_cast<uint16_t>( sizes[g] - 1 );
+                }
+                level.swap( upper );
+                ++_height;
+            }
+            if ( !level.empty() )
+            {
+                _root = level[0].second;
+            }
+        }
+
+        /// һеĽ״̬
+        void _Swap( BPlusTree &other )
+        {
+            _leaf_pool.Swap( other._leaf_pool );
+            _inner_pool.Swap( other._inner_pool );
+            swap( _root, other._root );
+            swap( _first_leaf, other._first_leaf );
+            swap( _last_leaf, other._last_leaf );
+            swap( _size, other._size );
+            swap( _height, other._height );
+        }
+
+        _LeafNode * _NewLeaf()
+        {
+            _LeafNode *leaf = new ( _leaf_pool.Allocate() ) _LeafNode;
+            leaf->IsLeaf = true;
+            leaf->Count = 0;
+            leaf->Prev = leaf->Next = nullptr;
+            return leaf;
+        }
+
+        _InnerNode * _NewInner()
+        {
+            _InnerNode *inner = new ( _inner_pool.Allocate() ) _InnerNode;
+            inner->IsLeaf = false;
+            inner->Count = 0;
+            return inner;
+        }
+
+        /// ӸߵkeyڵҶӽ㣬pathΪʱ¾·
+        _LeafNode * _FindLeaf( KeyType const &key, _Path *path = nullptr ) const
+        {
+            _NodeHeader *node = _root;
+            while ( !node->IsLeaf )
+            {
+                _InnerNode *inner = static_cast<_InnerNode *>( node );
+                size_t slot = _UpperBound( inner->Keys, inner->Count, key );
+                if ( path )
+                {
+                    path->Nodes[path->Depth] = inner;
+                    path->Slots[path->Depth] = slot;
+                    ++path->Depth;
+                }
+                node = inner->Children[slot];
+            }
+            return static_cast<_LeafNode *>( node );
+        }
+
+        /// δҶӽposһԪ
+        static void _InsertIntoLeaf( _LeafNode *leaf, size_t pos, KeyType const &key, ValueType const &value )
+        {
+            copy_backward( leaf->Keys + pos, leaf->Keys + leaf->Count, leaf->Keys + leaf->Count + 1 );
+            copy_backward( leaf->Values + pos, leaf->Values + leaf->Count, leaf->Values + leaf->Count + 1 );
+            leaf->Keys[pos] = key;
+            leaf->Values[pos] = value;
+            ++leaf->Count;
+        }
+
+        /// @brief ѳµֵrightѷָؼseparator뵽·ϵĸ
+        ///
+        /// Ҳʱѣһֱʱһ
+        void _InsertIntoParent( _Path &path, KeyType separator, _NodeHeader *right )
+        {
+            while ( path.Depth > 0 )
+            {
+                --path.Depth;
+                _InnerNode *parent = path.Nodes[path.Depth];
+                size_t slot = path.Slots[path.Depth];
+
+                if ( parent->Count < InnerCapacity )
+                {
+                    copy_backward( parent->Keys + slot, parent->Keys + parent->Count, parent->Keys + parent->Count + 1 );
+                    copy_backward( parent->Children + slot + 1, parent->Children + parent->Count + 1, parent->Children + parent->Count + 2 );
+                    parent->Keys[slot] = separator;
+                    parent->Children[slot + 1] = right;
+                    ++parent->Count;
+                    return;
+                }
+
+                //ȰInnerCapacity + 1ؼźãмһһ㣬߸Ϊһ
+                KeyType keys[InnerCapacity + 1];
+                _NodeHeader *children[InnerCapacity + 2];
+                copy( parent->Keys, parent->Keys + slot, keys );
+                keys[slot] = separator;
+                copy( parent->Keys + slot, parent->Keys + InnerCapacity, keys + slot + 1 );
+                copy( parent->Children, parent->Children + slot + 1, children );
+                children[slot + 1] = right;
+                copy( parent->Children + slot + 1, parent->Children + InnerCapacity + 1, children + slot + 2 );
+
+                size_t mid = ( InnerCapacity + 1 ) / 2;
+                _InnerNode *new_inner = _NewInner();
+                parent->Count = static_cast<uint16_t>( mid );
+                copy( keys, keys + mid, parent->Keys );
+                copy( children, children + mid + 1, parent->Children );
+                new_inner->Count = static_cast<uint16_t>( InnerCapacity - mid );
+                copy( keys + mid + 1, keys + InnerCapacity + 1, new_inner->Keys );
+                copy( children + mid + 1, children + InnerCapacity + 2, new_inner->Children );
+
+                separator = keys[mid];
+                right = new_inner;
+            }
+
+            //ѵ˸㣬Ҫ
+            _InnerNode *new_root = _NewInner();
+            new_root->Count = 1;
+            new_root->Keys[0] = separator;
+            new_root->Children[0] = _root;
+            new_root->Children[1] = right;
+            _root = new_root;
+            ++_height;
+        }
+
+        /// Ҷӽ㲻ֵܽһԪأ費ʱֵܺϲ
+        void _RebalanceLeaf( _Path &path, _LeafNode *leaf )
+        {
+            _InnerNode *parent = path.Nodes[path.Depth - 1];
+            size_t slot = path.Slots[path.Depth - 1];
+            _LeafNode *left = slot > 0 ? static_cast<_LeafNode *>( parent->Children[slot - 1] ) : nullptr;
+            _LeafNode *right = slot < parent->Count ? static_cast<_LeafNode *>( parent->Children[slot + 1] ) : nullptr;
+
+            if ( left && left->Count > LeafCapacity / 2 )
+            {
+                _InsertIntoLeaf( leaf, 0, left->Keys[left->Count - 1], left->Values[left->Count - 1] );
+                --left->Count;
+                parent->Keys[slot - 1] = leaf->Keys[0];
+                return;
+            }
+            if ( right && right->Count > LeafCapacity / 2 )
+            {
+                _InsertIntoLeaf( leaf, leaf->Count, right->Keys[0], right->Values[0] );
+                copy( right->Keys + 1, right->Keys + right->Count, right->Keys );
+                copy( right->Values + 1, right->Values + right->Count, right->Values );
+                --right->Count;
+                parent->Keys[slot] = right->Keys[0];
+                return;
+            }
+
+            //費ϲߵĽУɾұߵĽ
+            if ( left )
+            {
+                right = leaf;
+                --slot;
+            }
+            else
+            {
+                left = leaf;
+            }
+            copy( right->Keys, right->Keys + right->Count, left->Keys + left->Count );
+            copy( right->Values, right->Values + right->Count, left->Values + left->Count );
+            left->Count = static_cast<uint16_t>( left->Count + right->Count );
+            left->Next = right->Next;
+            ( right->Next ? right->Next->Prev : _last_leaf ) = left;
+            _leaf_pool.Release( right );
+
+            _RemoveFromParent( path, slot );
+        }
+
+        /// @brief еĵslotؼslot + 1Ϊϲɾ
+        ///
+        /// ˲ʱͬؽߺϲһֱֻʣһʱһ
+        void _RemoveFromParent( _Path &path, size_t slot )
+        {
+            --path.Depth;
+            _InnerNode *node = path.Nodes[path.Depth];
+            copy( node->Keys + slot + 1, node->Keys + node->Count, node->Keys + slot );
+            copy( node->Children + slot + 2, node->Children + node->Count + 1, node->Children + slot + 1 );
+            --node->Count;
+
+            if ( path.Depth == 0 )
+            {
+                if ( node->Count == 0 )
+                {
+                    _root = node->Children[0];
+                    _inner_pool.Release( node );
+                    --_height;
+                }
+                return;
+            }
+            if ( node->Count >= InnerCapacity / 2 )
+            {
+                return;
+            }
+
+            _InnerNode *parent = path.Nodes[path.Depth - 1];
+            size_t parent_slot = path.Slots[path.Depth - 1];
+            _InnerNode *left = parent_slot > 0 ? static_cast<_InnerNode *>( parent->Children[parent_slot - 1] ) : nullptr;
+            _InnerNode *right = parent_slot < parent->Count ? static_cast<_InnerNode *>( parent->Children[parent_slot + 1] ) : nullptr;
+
+            if ( left && left->Count > InnerCapacity / 2 )
+            {
+                //Ÿеķָؼתһ
+                copy_backward( node->Keys, node->Keys + node->Count, node->Keys + node->Count + 1 );
+                copy_backward( node->Children, node->Children + node->Count + 1, node->Children + node->Count + 2 );
+                node->Keys[0] = parent->Keys[parent_slot - 1];
+                node->Children[0] = left->Children[left->Count];
+                ++node->Count;
+                parent->Keys[parent_slot - 1] = left->Keys[left->Count - 1];
+                --left->Count;
+                return;
+            }
+            if ( right && right->Count > InnerCapacity / 2 )
+            {
+                //Ÿеķָؼתһ
+                node->Keys[node->Count] = parent->Keys[parent_slot];
+                node->Children[node->Count + 1] = right->Children[0];
+                ++node->Count;
+                parent->Keys[parent_slot] = right->Keys[0];
+                copy( right->Keys + 1, right->Keys + right->Count, right->Keys );
+                copy( right->Children + 1, right->Children + right->Count + 1, right->Children );
+                --right->Count;
+                return;
+            }
+
+            //費еķָؼƣұߵĽһϲߵĽ
+            if ( left )
+            {
+                right = node;
+                --parent_slot;
+            }
+            else
+            {
+                left = node;
+            }
+            left->Keys[left->Count] = parent->Keys[parent_slot];
+            copy( right->Keys, right->Keys + right->Count, left->Keys + left->Count + 1 );
+            copy( right->Children, right->Children + right->Count + 1, left->Children + left->Count + 1 );
+            left->Count = static_cast<uint16_t>( left->Count + 1 + right->Count );
+            _inner_pool.Release( right );
+
+            _RemoveFromParent( path, parent_slot );
+        }
+
+        void _GetDotLanguageViaNodeAndEdge( stringstream &ss, _NodeHeader *node )
+        {
+            KeyType const *keys = node->IsLeaf ? static_cast<_LeafNode *>( node )->Keys : static_cast<_InnerNode *>( node )->Keys;
+            ss << "    node" << node << "[label = \"";
+            for ( size_t i = 0; i < node->Count; ++i )
+            {
+                ss << ( i > 0 ? "|" : "" ) << "<f" << i << ">" << keys[i];
+            }
+            ss << "\"];" << endl;
+
+            if ( !node->IsLeaf )
+            {
+                _InnerNode *inner = static_cast<_InnerNode *>( node );
+                for ( size_t i = 0; i <= inner->Count; ++i )
+                {
+                    ss << "    \"node" << node << "\" -> \"node" << inner->Children[i] << "\";" << endl;
+                    _GetDotLanguageViaNodeAndEdge( ss, inner->Children[i] );
+                }
+            }
+        }
+
+        NodePool<_LeafNode, 64, NodeBytes>		_leaf_pool;		///< ҶӽأʱһͷеҶӽ
+        NodePool<_InnerNode, 64, NodeBytes>	_inner_pool;	///< ڲ
+        _NodeHeader				*_root;			///< 
+        _LeafNode				*_first_leaf;	///< ߵҶӽ㣬Ҷͷ
+        _LeafNode				*_last_leaf;	///< ұߵҶӽ㣬Ҷβ
+        size_t					_size;			///< Ԫصĸ
+        size_t					_height;		///< ĸ߶
+    };
+
+    template<typename KeyType, typename ValueType, size_t NodeBytes>
+    size_t const BPlusTree<KeyType, ValueType, NodeBytes>::LeafCapacity;
+
+    template<typename KeyType, typename ValueType, size_t NodeBytes>
+    size_t const BPlusTree<KeyType, ValueType, NodeBytes>::InnerCapacity;
+}
\ No newline at end of file
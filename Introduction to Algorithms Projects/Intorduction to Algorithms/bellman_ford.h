@@ -23,6 +23,7 @@
 #include <bitset>
 #include <queue>
 #include <limits>
+#include <algorithm>
 #include "graphics.h"
 
 using namespace std;
@@ -33,8 +34,8 @@ namespace ita
     namespace
     {
         /// ʼ
-        template<typename T>
-        void InitializeSingleSource( GraphicsViaAdjacencyList<T> &g, vector<int> &d, vector<int> &parent_index, int start_index )
+        template<typename GraphType>
+        void InitializeSingleSource( GraphType &g, vector<int> &d, vector<int> &parent_index, int start_index )
         {
             for ( size_t i = 0; i < g.GetVertex().size(); ++i )
             {
@@ -46,16 +47,23 @@ namespace ita
 
         /// @brief ɳ
         ///
-        /// ǰǣindex1->index2һ
-        /// index1ɳindex2dֵparent[index2] = index1
-        template<typename T>
-        void Relax( GraphicsViaAdjacencyList<T> &g, vector<int> &d, vector<int> &parent_index, int index1, int index2 )
+        /// ñe = (u, v, w)ɳvdֵɳڳɹparent[v] = u\n
+        /// ߵȨֱֵȡԪ飬Ҫͼвߡ
+        /// @return		d[v]Ƿ񱻸С
+        inline bool Relax( vector<int> &d, vector<int> &parent_index, WeightedEdge const &e )
         {
-            if ( d[index2] > d[index1] + g.IsLinked( index1, index2 ).second->Weight )
+            if ( d[e.StartNodeIndex] == numeric_limits<int>::max() )
             {
-                d[index2] = d[index1] + g.IsLinked( index1, index2 ).second->Weight;
-                parent_index[index2] = index1;
+                //㻹ɴκȨֵȻ
+                return false;
+            }
+            if ( d[e.AimNodeIndex] > d[e.StartNodeIndex] + e.Weight )
+            {
+                d[e.AimNodeIndex] = static_cast<int>( d[e.StartNodeIndex] + e.Weight );
+                parent_index[e.AimNodeIndex] = e.StartNodeIndex;
+                return true;
             }
+            return false;
         }
     }
 
@@ -63,32 +71,40 @@ namespace ita
     ///
     /// <b>·һ㵽һȨֵ·㷨һȨλȨֵͼִе·㷨</b>\n
     /// Bellman-Ford㷨ǳ򵥣еı߽|v|-1ѭÿѭжÿһ߽ɳڵĲ\n
+    /// еıһȡ(, յ, Ȩֵ)Ԫ飬ÿɳڶO(1)ģ㷨ΪO(VE)ĳһûɳκα߾Ϳǰ\n
     /// @remarks		floyd㷨ߴڸȨߣֻҪڴԴɴĸȨ·ŸȨ·ܼ
-    /// @param	g				ڽӱʾͼ
+    /// @param	g				ڽӱCSRʾͼ
     /// @param	start_index		㶥start_indexе·
     /// @param	d				㷨d[i]洢start_indexi·
     /// @parem	parent_index	¼㷨еĽеѡ㷨parent_index[i]ʾstart_indexi·ĵڶı
     /// @return			㷨ǷִгɹȡͼǷڡȨ·
     /// @retval	true	㷨ִгɹͼвڡȨ·
     /// @retval	false	㷨ִʧܣͼдڡȨ·
-    template<typename T>
-    bool BellmanFord( GraphicsViaAdjacencyList<T> &g, int start_index, vector<int> &d, vector<int> &parent_index )
+    template<typename GraphType>
+    bool BellmanFord( GraphType &g, int start_index, vector<int> &d, vector<int> &parent_index )
     {
-        auto edges = g.GetAllEdges();
+        auto edges = g.GetAllWeightedEdges();
 
         InitializeSingleSource( g, d, parent_index, start_index );
 
-        for ( size_t i = 0; i < g.GetVertex().size() - 1; ++i )
+        for ( size_t i = 0; i + 1 < g.GetVertex().size(); ++i )
         {
-            for_each( edges.begin(), edges.end(), [&]( pair<size_t, size_t> const & p )
+            bool relaxed = false;
+            for_each( edges.begin(), edges.end(), [&]( WeightedEdge const & e )
             {
-                Relax( g, d, parent_index, p.first, p.second );
+                relaxed |= Relax( d, parent_index, e );
             } );
+
+            if ( !relaxed )
+            {
+                //һûκdֵı䣬ԺĸҲٸı
+                break;
+            }
         }
 
         for ( size_t i = 0; i < edges.size(); ++i )
         {
-            if ( d[edges[i].second] > d[edges[i].first] + g.IsLinked( edges[i].first, edges[i].second ).second->Weight )
+            if ( d[edges[i].StartNodeIndex] != numeric_limits<int>::max() && d[edges[i].AimNodeIndex] > d[edges[i].StartNodeIndex] + edges[i].Weight )
             {
                 return false;
             }
@@ -12,6 +12,7 @@
 //////////////////////////////////////////////////////////////////////////
 /// ޸ļ¼
 /// 2011/06/17   14:42	1.0	̷	
+/// 2026/10/17	1.1	̷	ΪķƵʣKnuthķO(n^2)ʱڼ㣬ɾ̬
 
 
 #include <iostream>
@@ -20,11 +21,122 @@
 #include <iterator>
 #include <iomanip>
 #include <limits>
+#include <numeric>
 #include <fstream>
+#include <ctime>
+#include <random>
+#include "best_binary_search_tree.h"
 using namespace std;
 
 namespace ita
 {
+    double OptimalBinarySearchTree( vector<double> const &key_frequencies, vector<double> const &gap_frequencies, vector<vector<int>> &root )
+    {
+        size_t const n = key_frequencies.size();
+        if ( gap_frequencies.size() != n + 1 )
+        {
+            throw exception( "gap_frequenciesĸkey_frequencies1" );
+        }
+
+        //ǰ׺ͣw[i][j] = (P[j] - P[i-1]) + (Q[j+1] - Q[i-1])P[k] = p1 + ... + pkQ[k] = q0 + ... + q(k-1)
+        vector<double> P( n + 1, 0 ), Q( n + 2, 0 );
+        for ( size_t k = 1; k <= n; ++k )
+        {
+            if ( key_frequencies[k - 1] < 0 )
+            {
+                throw exception( "ƵʲΪ" );
+            }
+            P[k] = P[k - 1] + key_frequencies[k - 1];
+        }
+        for ( size_t k = 1; k <= n + 1; ++k )
+        {
+            if ( gap_frequencies[k - 1] < 0 )
+            {
+                throw exception( "ƵʲΪ" );
+            }
+            Q[k] = Q[k - 1] + gap_frequencies[k - 1];
+        }
+
+        //e[i][j]1 <= i <= n+1i-1 <= j <= nʾki...kjɵҴۣдһ
+        size_t const columns = n + 1;
+        vector<double> e( ( n + 2 ) * columns, 0 );
+        root.assign( n + 2, vector<int>( n + 1, 0 ) );
+
+        //e[i][j]j<iʱe[i][j]Ҷӽ㡣e[i][i-1]ǵi-1ҶӽҴ
+        for ( size_t i = 1; i <= n + 1; ++i )
+        {
+            e[i * columns + i - 1] = gap_frequencies[i - 1];
+        }
+
+        //еƣ֪ΪnӼŶضҪ֪СnӼŶ
+        for ( size_t length = 1; length <= n; ++length )
+        {
+            for ( size_t i = 1; i + length - 1 <= n; ++i )
+            {
+                size_t j = i + length - 1;
+                double w = ( P[j] - P[i - 1] ) + ( Q[j + 1] - Q[i - 1] );
+
+                //Knuthŵĸֻroot[i][j-1]...root[i+1][j]֮
+                size_t first = ( length == 1 ? i : static_cast<size_t>( root[i][j - 1] ) );
+                size_t last = ( length == 1 ? i : static_cast<size_t>( root[i + 1][j] ) );
+
+                double best = numeric_limits<double>::max();
+                size_t best_root = first;
+                for ( size_t r = first; r <= last; ++r )
+                {
+                    //krΪ[ki...kj]ĸ
+                    double cost = e[i * columns + r - 1] + e[( r + 1 ) * columns + j] + w;
+                    if ( cost < best )
+                    {
+                        best = cost;
+                        best_root = r;
+                    }
+                }
+                e[i * columns + j] = best;
+                root[i][j] = static_cast<int>( best_root );
+            }
+        }
+
+        double total = P[n] + Q[n + 1];
+        return total > 0 ? e[1 * columns + n] / total : 0;
+    }
+
+    double SearchTreeCost( vector<double> const &key_frequencies, vector<double> const &gap_frequencies, vector<vector<int>> const &root )
+    {
+        size_t const n = key_frequencies.size();
+        if ( gap_frequencies.size() != n + 1 )
+        {
+            throw exception( "gap_frequenciesĸkey_frequencies1" );
+        }
+
+        //ջд<<i, j>, ĸ>ܺܲƽ⣬õݹ
+        double cost = 0;
+        double total = 0;
+        vector<pair<pair<size_t, size_t>, size_t>> stack( 1, make_pair( make_pair( static_cast<size_t>( 1 ), n ), static_cast<size_t>( 0 ) ) );
+        while ( !stack.empty() )
+        {
+            size_t i = stack.back().first.first;
+            size_t j = stack.back().first.second;
+            size_t depth = stack.back().second;
+            stack.pop_back();
+
+            if ( i > j )
+            {
+                //Ҷӽd(i-1)
+                cost += gap_frequencies[i - 1] * ( depth + 1 );
+                total += gap_frequencies[i - 1];
+                continue;
+            }
+
+            size_t r = static_cast<size_t>( root[i][j] );
+            cost += key_frequencies[r - 1] * ( depth + 1 );
+            total += key_frequencies[r - 1];
+            stack.push_back( make_pair( make_pair( i, r - 1 ), depth + 1 ) );
+            stack.push_back( make_pair( make_pair( r + 1, j ), depth + 1 ) );
+        }
+        return total > 0 ? cost / total : 0;
+    }
+
     /// @brief Ŷ
     ///
     /// һK={k1<k2<k3<,,<kn}ǱѯĸP={p1,p2,p3,,pn}ҪһöTʹòѯԪصܵĴС
@@ -33,62 +145,94 @@ namespace ita
     /// ʧӦdiĸQ={q0,q1,,qn}
     void BestBinarySearchTree()
     {
-        //p1 ... p5p0ǸռλΪ˺ı뷽㣬p0
-        double p[] = {0, 0.15, 0.1, 0.05, 0.1, 0.2};
+        //ϵӣp1 ... p5q0 ... q5
+        double p[] = {0.15, 0.1, 0.05, 0.1, 0.2};
         double q[] = {0.05, 0.1, 0.05, 0.05, 0.05, 0.1};
+        vector<double> key_frequencies( p, p + 5 );
+        vector<double> gap_frequencies( q, q + 6 );
 
-        //e[i][j]ʾpi -- pjŶҴ
-        vector< vector<double> > e( 7, vector<double>( 6 ) );
-        //w[i][j]ʾpi -- pjĸܺ
-        vector< vector<double> > w( 7, vector<double>( 6 ) );
+        //p1...p5ŶҴroot
+        vector<vector<int>> root;
+        cout << "Ҵۣ" << OptimalBinarySearchTree( key_frequencies, gap_frequencies, root ) << endl;
+        for ( size_t i = 1; i <= 5; ++i )
+        {
+            for ( size_t j = 1; j <= 5; ++j )
+            {
+                cout << setw( 3 ) << ( j >= i ? root[i][j] : 0 );
+            }
+            cout << endl;
+        }
 
-        //ȼҶӽ㵥ΪһʱҴ
-        //e[i][j]j<iʱe[i][j]Ҷӽ㡣e[i][i-1]ǵi-1ҶӽҴ
-        for ( int i = 1; i < 7; ++i )
+        vector<int> keys;
+        for ( int i = 1; i <= 5; ++i )
         {
-            e[i][i - 1] = q[i - 1];
+            keys.push_back( i );
         }
+        StaticSearchTree<int> tree = BuildOptimalSearchTree( keys, key_frequencies, gap_frequencies );
+        vector<int> layout = tree.LayoutKeys();
+        cout << "vEB˳ŵŶ";
+        copy( layout.begin(), layout.end(), ostream_iterator<int>( cout, " " ) );
+        cout << endl << endl;
 
-        //pi -- pjĸܺͣͨҶӽ㶼Ҫ
-        for ( int i = 1; i < 7; ++i )
+        //ģѯ־Ƶʸ߶бZipfֲŹؼطֲУʧ
+        size_t const n = 4000;
+        vector<int> sorted_keys( n );
+        vector<size_t> popularity( n );
+        for ( size_t i = 0; i < n; ++i )
+        {
+            sorted_keys[i] = static_cast<int>( i * 2 );
+            popularity[i] = i;
+        }
+        shuffle( popularity.begin(), popularity.end(), mt19937( rand() ) );
+        key_frequencies.assign( n, 0 );
+        gap_frequencies.assign( n + 1, 0.01 / ( n + 1 ) );
+        for ( size_t i = 0; i < n; ++i )
         {
-            for ( int j = i - 1; j < 6; ++j )
+            key_frequencies[i] = 1.0 / ( popularity[i] + 1 );
+        }
+
+        clock_t start = clock();
+        double optimal_cost = OptimalBinarySearchTree( key_frequencies, gap_frequencies, root );
+        cout << n << "ؼֵŶKnuth O(n^2)ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "ms" << endl;
+
+        vector<vector<int>> balanced_root( n + 2, vector<int>( n + 1, 0 ) );
+        for ( size_t i = 1; i <= n; ++i )
+        {
+            for ( size_t j = i; j <= n; ++j )
             {
-                for ( int k = i; k <= j; ++k )
-                {
-                    //ͨ
-                    w[i][j] += p[k];
-                }
-                for ( int k = i - 1; k <= j; ++k )
-                {
-                    //Ҷӽ
-                    w[i][j] += q[k];
-                }
+                balanced_root[i][j] = static_cast<int>( ( i + j ) / 2 );
             }
         }
+        cout << "Ƚϴ" << optimal_cost << "ƽ" << SearchTreeCost( key_frequencies, gap_frequencies, balanced_root ) << endl;
 
-        //ְеƵ뷨ԣΪϵ
-        //֪ΪnӼŶضҪ֪СnӼŶ
-        for ( int length = 1; length <= 5; ++length )
+        //ͬķֲɲѯʧܵƵʺСֻɲҳɹĲѯֱƽEytzinger֣ϲҡ
+        //ע⣺ʡµǱȽϴؼֺСȫڻʱƽȹ̶ѭĳܱԤȷ
+        //ڵĲҿصִУʵʱܸ̣ȽϻôĴԽߣַڴϣԽ
+        vector<double> cumulative( n );
+        partial_sum( key_frequencies.begin(), key_frequencies.end(), cumulative.begin() );
+        size_t const query_count = 1 << 22;
+        vector<int> queries( query_count );
+        for ( size_t i = 0; i < query_count; ++i )
         {
-            //ӳȶ̵ӼʼƵȳӼ
-            for ( int i = 1; i < 6 - length + 1; ++i )
-            {
-                //[i...j]ӼмҴ
-                int j = i + length - 1;
+            double x = ( rand() * ( RAND_MAX + 1.0 ) + rand() ) / ( ( RAND_MAX + 1.0 ) * ( RAND_MAX + 1.0 ) ) * cumulative[n - 1];
+            size_t k = min( static_cast<size_t>( lower_bound( cumulative.begin(), cumulative.end(), x ) - cumulative.begin() ), n - 1 );
+            queries[i] = sorted_keys[k];
+        }
 
-                vector<double> vs;
-                for ( int k = i; k <= j; ++k )
-                {
-                    //i<=k<=jkλý[i...j]л֣pkΪ[pi...pj]ĸ
-                    vs.push_back( p[k] + e[i][k - 1] + w[i][k - 1] + e[k + 1][j] + w[k + 1][j] );
-                }
-                e[i][j] = *min_element( vs.begin(), vs.end() );
+        StaticSearchTree<int> optimal = BuildOptimalSearchTree( sorted_keys, key_frequencies, gap_frequencies );
+        StaticSearchTree<int> balanced( sorted_keys, Eytzinger );
+        StaticSearchTree<int> const *trees[] = {&optimal, &balanced};
+        char const *names[] = {"vEB", "ƽEytzinger"};
+        for ( int t = 0; t < 2; ++t )
+        {
+            start = clock();
+            size_t found = 0;
+            for ( size_t i = 0; i < query_count; ++i )
+            {
+                found += trees[t]->Search( queries[i] );
             }
+            cout << names[t] << "" << query_count << "ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "ߣ" << trees[t]->Height() << endl;
         }
-
-        //p1...p5ŶҴ
-        cout << e[1][5] << endl;
         getchar();
     }
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		best_binary_search_tree.h
+/// @brief		ŶɷƵʼrootɿԲҵľ̬
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include "static_search_tree.h"
+using namespace std;
+
+namespace ita
+{
+    /// @brief ɷƵʼŶ
+    ///
+    /// ϵOPTIMAL-BSTֻͬKnuthĽۣroot[i][j-1] <= root[i][j] <= root[i+1][j]
+    /// e[i][j]ʱֻҪΧڵĸڹ̶ĳȣiĳԴ֮O(n)ģܵʱO(n^3)ΪO(n^2)\n
+    /// w[i][j]ǰ׺ֱӵõҪٴһn*nı
+    /// @param	key_frequencies		ؼk1...knҵƵʣ±0...n-1Уǲѯ־еĴҪһ
+    /// @param	gap_frequencies		ʧd0...dnϵƵʣkey_frequencies1
+    /// @param	root				ͬrootroot[i][j]1 <= i <= j <= nΪki...kjɵĸı
+    /// @return						ŶҴۣƵʼȨƽȽϴ
+    double OptimalBinarySearchTree( vector<double> const &key_frequencies, vector<double> const &gap_frequencies, vector<vector<int>> &root );
+
+    /// @brief rootĶڸƵµҴ
+    ///
+    /// ȽŶ״ƽͬķʷֲµĴ
+    double SearchTreeCost( vector<double> const &key_frequencies, vector<double> const &gap_frequencies, vector<vector<int>> const &root );
+
+    /// @brief ϸĹؼּƵʽҴСľ̬
+    ///
+    /// @param	sorted_keys			ϸĹؼ
+    /// @param	key_frequencies		ÿؼֱҵƵ
+    /// @param	gap_frequencies		ʧڹؼ֮䣨Լ֮⣩Ƶ
+    /// @param	layout				̬Ĳַʽ
+    /// @param	expected_cost		ΪʱҴ
+    /// @see	class StaticSearchTree
+    template<typename KeyType>
+    StaticSearchTree<KeyType> BuildOptimalSearchTree( vector<KeyType> const &sorted_keys, 
+        vector<double> const &key_frequencies, vector<double> const &gap_frequencies, 
+        StaticTreeLayout layout = VanEmdeBoas, double *expected_cost = nullptr )
+    {
+        if ( sorted_keys.size() != key_frequencies.size() )
+        {
+            throw exception( "ؼƵʵĸһ" );
+        }
+
+        vector<vector<int>> root;
+        double cost = OptimalBinarySearchTree( key_frequencies, gap_frequencies, root );
+        if ( expected_cost )
+        {
+            *expected_cost = cost;
+        }
+        return StaticSearchTree<KeyType>( sorted_keys, root, layout );
+    }
+}
\ No newline at end of file
@@ -12,6 +12,8 @@
 //////////////////////////////////////////////////////////////////////////
 /// ޸ļ¼
 /// 2011/06/17   13:02	1.0	̷	
+/// 2026/10/17	1.1	̷	Ϊǵݹʵ֣ɽط䣬ѣtreapƽģʽ
+/// 2026/10/17	1.2	̷	Ӿ̬Ĳ
 
 
 #include <iostream>
@@ -21,6 +23,10 @@
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <ctime>
+#include <cstdint>
+#include "node_pool.h"
+#include "static_search_tree.h"
 #include "graphviz_shower.h"
 using namespace std;
 
@@ -30,6 +36,13 @@ namespace ita
 	///
 	/// Ķ壺κνXеĹؼ󲻳key[X]еĹؼССkey[x]
 	/// ֤ĶƽµΪӽµΪǽӽµΪһnؼĶ߶ΪO(lgn)
+	///
+	/// ǰ˳ʱ˻һ߶Ϊnκεݹınﵽʮʱջԣ
+	/// - еĲҡ롢ɾͷšʾǷǵݹģݹȲ״
+	/// - ԼNodePoolз䣬ClearֻǰеĿ黹ϵͳ״ͽ޹أ
+	/// - ʱѡѣtreapģʽÿһȼڹؼǶȼǴѡ
+	///   ʱ½ΪҶ룬תϸȼʵλãɾʱȰѽת³ΪҶ㣨ֻһӽ㣩ժ
+	///   ״˳õĶͬ۲˳Σ߶ȶO(lgn)
 	class BinarySearchTree
 	{
 	private:
@@ -37,21 +50,20 @@ namespace ita
 		struct _Node
 		{
 			int Value;
+			uint32_t Priority;		///< ģʽµȼ
 			_Node *Parent;
 			_Node *Left;
 			_Node *Right;
 		};
 
 	public:
-		BinarySearchTree() : _root( nullptr )
+		/// @brief һÿյĶ
+		///
+		/// @param	treap	Ƿʹģʽƽ
+		explicit BinarySearchTree( bool treap = false ) 
+			: _root( nullptr ), _size( 0 ), _treap( treap ), _seed( static_cast<uint32_t>( rand() ) * 2654435761u + 1 )
 		{}
 
-		~BinarySearchTree()
-		{
-			//Ӹ㿪ʼݹ
-			_RecursiveReleaseNode( _root );
-		}
-
 		/// @brief һ
 		///
 		/// вһֵ
@@ -59,36 +71,33 @@ namespace ita
 		/// @return				ǷɹʧζѾڸֵ
 		bool Insert( int const new_value )
 		{
-			if ( Search( new_value ) )
+			//һ²Ҳλãһ߼ǷѾ
+			_Node *parent = nullptr;
+			_Node **link = &_root;
+			while ( *link )
 			{
-				//Ѿ
-				return false;
-			}
-
-			if ( !_root )
-			{
-				//ǵ1ڵ
-				_root = new _Node();
-				_root->Value = new_value;
-				return true;
+				if ( new_value == ( *link )->Value )
+				{
+					//Ѿ
+					return false;
+				}
+				parent = *link;
+				link = ( new_value > parent->Value ? &parent->Right : &parent->Left );
 			}
 
-			//ǵ1ڵ
-			_Node *current_node = _root;
+			_Node *new_node = new ( _pool.Allocate() ) _Node();
+			new_node->Value = new_value;
+			new_node->Priority = ( _treap ? _NextPriority() : 0 );
+			new_node->Parent = parent;
+			*link = new_node;
+			++_size;
 
-			while ( current_node )
+			if ( _treap )
 			{
-				_Node *&next_node_pointer = ( new_value > current_node->Value ? current_node->Right : current_node->Left );
-				if ( next_node_pointer )
-				{
-					current_node = next_node_pointer;
-				}
-				else
+				//ϸ½ȼȸʱתλ
+				while ( new_node->Parent && new_node->Priority > new_node->Parent->Priority )
 				{
-					next_node_pointer = new _Node();
-					next_node_pointer->Value = new_value;
-					next_node_pointer->Parent = current_node;
-					break;
+					_RotateUp( new_node );
 				}
 			}
 
@@ -127,32 +136,110 @@ namespace ita
 			return _Search( _root, search_value ) != nullptr;
 		}
 
+		/// ɾеĽ㣬޹صذѽеĿ黹ϵͳ
+		void Clear()
+		{
+			_pool.Clear();
+			_root = nullptr;
+			_size = 0;
+		}
+
+		/// ĸ
+		size_t Size() const
+		{
+			return _size;
+		}
+
+		/// ĸ߶ȣΪ0
+		size_t Height() const
+		{
+			//ʽջݹ飬ջб<, >
+			size_t height = 0;
+			vector<pair<_Node *, size_t>> stack;
+			if ( _root )
+			{
+				stack.push_back( make_pair( _root, static_cast<size_t>( 1 ) ) );
+			}
+			while ( !stack.empty() )
+			{
+				pair<_Node *, size_t> top = stack.back();
+				stack.pop_back();
+				height = max( height, top.second );
+				if ( top.first->Left )
+				{
+					stack.push_back( make_pair( top.first->Left, top.second + 1 ) );
+				}
+				if ( top.first->Right )
+				{
+					stack.push_back( make_pair( top.first->Right, top.second + 1 ) );
+				}
+			}
+			return height;
+		}
+
 		/// @brief ʹdotǰ
 		void Display() const
 		{
 			stringstream ss;
 			ss << "digraph graphname" << ( rand() % 1000 ) << "{" << endl
 				<< "    node [shape = record,height = .1];" << endl;
-			_Display( ss, _root );
+
+			//ʽջݹ
+			vector<_Node *> stack;
+			if ( _root )
+			{
+				stack.push_back( _root );
+			}
+			while ( !stack.empty() )
+			{
+				_Node *node = stack.back();
+				stack.pop_back();
+
+				ss << "    node" << node->Value << "[label = \"<f0>|<f1>" << node->Value << "|<f2>\"];" << endl;
+
+				if ( node->Right )
+				{
+					ss << "    \"node" << node->Value << "\":f2 -> \"node" << node->Right->Value << "\":f1;" << endl;
+					stack.push_back( node->Right );
+				}
+
+				if ( node->Left )
+				{
+					ss << "    \"node" << node->Value << "\":f0 -> \"node" << node->Left->Value << "\":f1;" << endl;
+					stack.push_back( node->Left );
+				}
+			}
+
 			ss << "}" << endl;
 
 			qi::ShowGraphvizViaDot( ss.str() );
 		}
 
 	private:
+		BinarySearchTree( BinarySearchTree const & );
+		BinarySearchTree & operator=( BinarySearchTree const & );
+
 		/// ɾ
 		///
 		/// ΨһеѶȵĵطɾͬʱĽʱҪһЩ\n
 		/// еȵĸӣʵԺܼ򵥵˵ףĽxҵxǰ̣yxֵ滻Ϊ
-		/// yֵȻݹɾyͿˡΪyһû̶ӦûԵݹɾʱǺܼ򵥵
-		/// ˡ
+		/// yֵȻɾyͿˡΪyһû̶ӦûɾyʱǺܼ򵥵
+		/// ˡ\n
+		/// ģʽ²ΪyȼԭػƻʣΪxȼϸߵӽһת³ֱһӽΪա
 		/// @note		ķȷϽܵҪö⣬﷽õĵĹؼڣ\n
 		///				ҵ_DeleteNodeĲҪɾĽָ룬ɾͬʱĽʱҿֱʹy
-		///				ֵx㣬ٵݹɾy㡣Ĳǽָǽֵٵݹɾyֵ
+		///				ֵx㣬ɾy㡣Ĳǽָǽֵɾyֵ
 		///				ʱͻ⣬Ϊʱxֵ==yֵˡţҵԽָΪ˼·ȷ
 		void _DeleteNode( _Node * delete_node )
 		{
-			if ( delete_node->Left && delete_node->Right )
+			if ( _treap )
+			{
+				while ( delete_node->Left && delete_node->Right )
+				{
+					_RotateUp( delete_node->Left->Priority > delete_node->Right->Priority ? delete_node->Left : delete_node->Right );
+				}
+			}
+			else if ( delete_node->Left && delete_node->Right )
 			{
 				//ҪɾĽͬʱ
 				//ǰ㣺ǰһڣΪýͬʱ
@@ -160,37 +247,73 @@ namespace ita
 
 				delete_node->Value = previous_node->Value;
 
-				//previous_ndeһûٵݹһifelse֧
-				_DeleteNode( previous_node );
+				//previous_ndeһûɾһļ
+				delete_node = previous_node;
 			}
-			else
+
+			//ҪɾĽһӽΪ
+			//sub_nodeΪdelete_node
+			//sub_nodeҪôΪdelete_nodeҪôΪdelete_nodedelete_nodeӽʱΪ
+			_Node *sub_node = ( delete_node->Left ? delete_node->Left : delete_node->Right );
+
+			_ChildLink( delete_node ) = sub_node;
+			if ( sub_node )
 			{
-				//ҪɾĽһӽΪ
-				//sub_nodeΪdelete_node
-				//sub_nodeҪôΪdelete_nodeҪôΪdelete_nodedelete_nodeӽʱΪ
-				_Node *sub_node = ( delete_node->Left ? delete_node->Left : delete_node->Right );
+				//delete_nodeӽʱҪӽParentָ
+				sub_node->Parent = delete_node->Parent;
+			}
+
+			_pool.Release( delete_node );
+			--_size;
+		}
+
+		/// ָnodeǸָ루nodeΪʱ_root
+		_Node *& _ChildLink( _Node *node )
+		{
+			if ( node->Parent == nullptr )
+			{
+				return _root;
+			}
+			return ( node->Parent->Left == node ? node->Parent->Left : node->Parent->Right );
+		}
 
-				if ( delete_node->Parent == nullptr )
+		/// @brief nodeתĸλ
+		///
+		/// nodeӽʱһӽʱһ˳򱣳ֲ
+		void _RotateUp( _Node *node )
+		{
+			_Node *parent = node->Parent;
+			_ChildLink( parent ) = node;
+			node->Parent = parent->Parent;
+
+			if ( parent->Left == node )
+			{
+				parent->Left = node->Right;
+				if ( node->Right )
 				{
-					//ǵ1
-					_root = sub_node;
+					node->Right->Parent = parent;
 				}
-				else
+				node->Right = parent;
+			}
+			else
+			{
+				parent->Right = node->Left;
+				if ( node->Left )
 				{
-					( delete_node->Parent->Left == delete_node 
-						? delete_node->Parent->Left 
-						: delete_node->Parent->Right ) 
-						= sub_node;
-
-					if ( sub_node )
-					{
-						//delete_nodeӽʱҪӽParentָ
-						sub_node->Parent = delete_node->Parent;
-					}
+					node->Left->Parent = parent;
 				}
-
-				delete delete_node;
+				node->Left = parent;
 			}
+			parent->Parent = node;
+		}
+
+		/// ѵȼxorshift
+		uint32_t _NextPriority()
+		{
+			_seed ^= _seed << 13;
+			_seed ^= _seed >> 17;
+			_seed ^= _seed << 5;
+			return _seed;
 		}
 
 		/// @brief õһͬʱĽڵǰ
@@ -216,16 +339,6 @@ namespace ita
 			return node;
 		}
 
-		void _RecursiveReleaseNode( _Node *node )
-		{
-			if ( node )
-			{
-				_RecursiveReleaseNode( node->Left );
-				_RecursiveReleaseNode( node->Right );
-				delete node;
-			}
-		}
-
 		/// ǵݹһ
 		_Node * _Search( _Node *node, int const search_value ) const
 		{
@@ -245,27 +358,11 @@ namespace ita
 			return node;
 		}
 
-		void _Display( stringstream &ss, _Node *node ) const
-		{
-			if ( node )
-			{
-				ss << "    node" << node->Value << "[label = \"<f0>|<f1>" << node->Value << "|<f2>\"];" << endl;
-
-				if ( node->Left )
-				{
-					ss << "    \"node" << node->Value << "\":f0 -> \"node" << node->Left->Value << "\":f1;" << endl;
-					_Display( ss, node->Left );
-				}
-
-				if ( node->Right )
-				{
-					ss << "    \"node" << node->Value << "\":f2 -> \"node" << node->Right->Value << "\":f1;" << endl;
-					_Display( ss, node->Right );
-				}
-			}
-		}
-
-		_Node *_root;			///< ĸ
+		_Node				*_root;			///< ĸ
+		size_t				_size;			///< ĸ
+		bool				_treap;			///< ǷΪģʽ
+		uint32_t			_seed;			///< ȼ״̬
+		NodePool<_Node>		_pool;			///< 
 	};
 
 
@@ -300,6 +397,150 @@ namespace ita
 			}
 		}
 
+		//룺ͨĶ˻Ϊѵĸ߶ȻO(lgn)
+		cout << endl;
+		int const plain_count = 20000;
+		int const treap_count = 1000000;
+		BinarySearchTree chain;
+		BinarySearchTree treap( true );
+		clock_t start = clock();
+		for ( int i = 0; i < plain_count; ++i )
+		{
+			chain.Insert( i );
+		}
+		cout << "ͨ" << plain_count << "ֵʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msߣ" << chain.Height() << endl;
+
+		start = clock();
+		for ( int i = 0; i < treap_count; ++i )
+		{
+			treap.Insert( i );
+		}
+		cout << "" << treap_count << "ֵʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msߣ" << treap.Height() << endl;
+
+		start = clock();
+		size_t found = 0;
+		for ( int i = 0; i < treap_count; i += 2 )
+		{
+			treap.Delete( i );
+		}
+		for ( int i = 0; i < treap_count; ++i )
+		{
+			found += treap.Search( i );
+		}
+		cout << "ɾżȫֵʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "ߣ" << treap.Height() << endl;
+
+		//״Ҳͷţջ
+		start = clock();
+		chain.Clear();
+		treap.Clear();
+		cout << "Clearʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msʣ㣺" << chain.Size() + treap.Size() << endl;
+
 		return 0;
 	}
+
+	/// Ծ̬Eytzingervan Emde Boas˳һеֻ
+	void testStaticSearchTree()
+	{
+		//15ؼֵȫֲµĴ˳
+		vector<int> keys;
+		for ( int i = 1; i <= 15; ++i )
+		{
+			keys.push_back( i * 10 );
+		}
+		StaticSearchTree<int> eytzinger( keys, Eytzinger );
+		StaticSearchTree<int> veb( keys, VanEmdeBoas );
+		vector<int> layout = eytzinger.LayoutKeys();
+		cout << "Eytzinger֣";
+		copy( layout.begin(), layout.end(), ostream_iterator<int>( cout, " " ) );
+		cout << endl;
+		layout = veb.LayoutKeys();
+		cout << "vEB֣      ";
+		copy( layout.begin(), layout.end(), ostream_iterator<int>( cout, " " ) );
+		cout << endl;
+
+		int const queries[] = {0, 10, 35, 150, 151};
+		for ( size_t i = 0; i < sizeof( queries ) / sizeof( queries[0] ); ++i )
+		{
+			cout << "LowerBound(" << queries[i] << ") = " << eytzinger.LowerBound( queries[i] ) << " / " << veb.LowerBound( queries[i] )
+				<< "Search" << eytzinger.Search( queries[i] ) << " / " << veb.Search( queries[i] ) << endl;
+		}
+
+		//ͼ15-7(b)Ŷk2Ϊk1k5Ϊӽ㣬k4Ϊk5ӽ㣬k3Ϊk4ӽ
+		vector<int> best_keys;
+		for ( int i = 1; i <= 5; ++i )
+		{
+			best_keys.push_back( i );
+		}
+		int const root_table[6][6] = 
+		{
+			{0, 0, 0, 0, 0, 0},
+			{0, 1, 1, 2, 2, 2},
+			{0, 0, 2, 2, 2, 4},
+			{0, 0, 0, 3, 4, 5},
+			{0, 0, 0, 0, 4, 5},
+			{0, 0, 0, 0, 0, 5}
+		};
+		vector<vector<int>> root( 6 );
+		for ( int i = 0; i < 6; ++i )
+		{
+			root[i].assign( root_table[i], root_table[i] + 6 );
+		}
+		StaticSearchTree<int> best( best_keys, root, VanEmdeBoas );
+		layout = best.LayoutKeys();
+		cout << "ŶvEB֣߶" << best.Height() << "";
+		copy( layout.begin(), layout.end(), ostream_iterator<int>( cout, " " ) );
+		cout << endl << endl;
+
+		//ܣͬҷֱѡϵĶֲҺ־̬
+		size_t const n = 1 << 20;
+		size_t const query_count = 1 << 22;
+		vector<int> sorted_keys( n );
+		for ( size_t i = 0; i < n; ++i )
+		{
+			sorted_keys[i] = static_cast<int>( i * 4 + rand() % 4 );
+		}
+		vector<int> query_keys( query_count );
+		for ( size_t i = 0; i < query_count; ++i )
+		{
+			query_keys[i] = static_cast<int>( ( static_cast<unsigned>( rand() ) * 32768u + static_cast<unsigned>( rand() ) ) % ( 4 * n ) );
+		}
+
+		BinarySearchTree treap( true );
+		for ( size_t i = 0; i < n; ++i )
+		{
+			treap.Insert( sorted_keys[i] );
+		}
+		clock_t start = clock();
+		size_t found = 0;
+		for ( size_t i = 0; i < query_count; ++i )
+		{
+			found += treap.Search( query_keys[i] );
+		}
+		cout << "Ѳ" << query_count << "ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "" << endl;
+
+		start = clock();
+		found = 0;
+		for ( size_t i = 0; i < query_count; ++i )
+		{
+			found += binary_search( sorted_keys.begin(), sorted_keys.end(), query_keys[i] );
+		}
+		cout << "ֲʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "" << endl;
+
+		StaticTreeLayout const layouts[] = {Eytzinger, VanEmdeBoas};
+		char const *names[] = {"Eytzinger", "vEB"};
+		for ( int l = 0; l < 2; ++l )
+		{
+			start = clock();
+			StaticSearchTree<int> tree( sorted_keys, layouts[l] );
+			double build_time = ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC;
+
+			start = clock();
+			found = 0;
+			for ( size_t i = 0; i < query_count; ++i )
+			{
+				found += tree.Search( query_keys[i] );
+			}
+			cout << names[l] << "̬ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "msҵ" << found << "ʱ" << build_time << "ms" << endl;
+		}
+	}
 }
\ No newline at end of file
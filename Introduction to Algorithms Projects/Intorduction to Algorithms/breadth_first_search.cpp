@@ -19,7 +19,10 @@
 #include <queue>
 #include <set>
 #include <bitset>
+#include <ctime>
+#include <chrono>
 #include "graphics.h"
+#include "breadth_first_search.h"
 
 using namespace std;
 
@@ -27,10 +30,10 @@ namespace ita
 {
     /// @brief ȱ
     ///
-    /// @param	g				ʹڽӱʾͼ
+    /// @param	g				ͼGraphicsViaAdjacencyListGraphicsViaCompressedSparseRow
     /// @param	start_index		㿪ʼйȱ
-    template<typename T>
-    void BreadthFirstSearch( GraphicsViaAdjacencyList<T> &g, size_t start_index )
+    template<typename GraphType>
+    void BreadthFirstSearch( GraphType &g, size_t start_index )
     {
         queue<size_t>	q;
         vector<bool>	trivaled( g.GetVertex().size(), false );
@@ -41,17 +44,17 @@ namespace ita
         while ( !q.empty() )
         {
             //ûбеĽ
-            char current = q.front();
+            size_t current = q.front();
             q.pop();
             cout << g.GetVertex()[current] << "  ";
 
-            for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+            for ( auto it = g.AdjacentBegin( current ); it != g.AdjacentEnd( current ); ++it )
             {
-                if ( !trivaled[i] && g.IsLinked( current, i ).first )
+                if ( !trivaled[it->AimNodeIndex] )
                 {
                     //ûб  뵱ǰԪڽ
-                    q.push( i );
-                    trivaled[i] = true;
+                    q.push( it->AimNodeIndex );
+                    trivaled[it->AimNodeIndex] = true;
                 }
             }
         }
@@ -79,5 +82,94 @@ namespace ita
 
         BreadthFirstSearch( g, 1 );
         cout << endl;
+
+        //CSRͼ֮ٱһ
+        GraphicsViaCompressedSparseRow<char> csr( g );
+        BreadthFirstSearch( csr, 1 );
+        cout << endl;
+
+        //й˳򣬶Ƿÿľ븸
+        vector<int> d, parent_index;
+        size_t reached = ParallelBreadthFirstSearch( csr, 1, d, parent_index, 2 );
+        cout << "й" << reached << "㣺" << endl;
+        for ( size_t i = 0; i < v.size(); ++i )
+        {
+            cout << v[i] << "d = " << d[i] << "parent = " << ( parent_index[i] < 0 ? '-' : v[parent_index[i]] ) << endl;
+        }
+    }
+
+    /// ĴͼϱȽϴеĹ뷽ŻĲй
+    void BreadthFirstSearchBenchmark()
+    {
+        size_t const n = 1 << 20;
+        size_t const edge_count = 8 * n;
+        auto random_index = [n]()
+        {
+            return ( static_cast<size_t>( rand() ) * ( RAND_MAX + 1u ) + static_cast<size_t>( rand() ) ) % n;
+        };
+
+        GraphicsType const types[] = {Undigraph, Digraph};
+        char const *names[] = {"ͼ", "ͼ"};
+        for ( int t = 0; t < 2; ++t )
+        {
+            vector<int> v( n );
+            GraphicsViaAdjacencyList<int> list( v, types[t] );
+            for ( size_t i = 0; i < edge_count; ++i )
+            {
+                list.Link2Vertex( random_index(), random_index() );
+            }
+            GraphicsViaCompressedSparseRow<int> g( list );
+            cout << names[t] << "" << n << "㣬" << edge_count << "" << endl;
+
+            //еĶʵΪ׼
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            vector<int> expected( n, numeric_limits<int>::max() );
+            queue<size_t> q;
+            q.push( 0 );
+            expected[0] = 0;
+            while ( !q.empty() )
+            {
+                size_t u = q.front();
+                q.pop();
+                for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+                {
+                    if ( expected[it->AimNodeIndex] == numeric_limits<int>::max() )
+                    {
+                        expected[it->AimNodeIndex] = expected[u] + 1;
+                        q.push( it->AimNodeIndex );
+                    }
+                }
+            }
+            cout << "    Զ£" << chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count() << "ms" << endl;
+
+            //ͼķڽͼֻһΣ֮ÿһʹ
+            unique_ptr<ReverseAdjacency> reverse;
+            if ( types[t] == Digraph )
+            {
+                start = chrono::steady_clock::now();
+                reverse.reset( new ReverseAdjacency( g ) );
+                cout << "    췴ڽͼ" << chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count() << "ms" << endl;
+            }
+
+            size_t const max_threads = max( thread::hardware_concurrency(), 1u );
+            for ( size_t threads = 1; threads <= max_threads; threads *= 2 )
+            {
+                vector<int> d, parent_index;
+                start = chrono::steady_clock::now();
+                size_t reached = ParallelBreadthFirstSearch( g, 0, d, parent_index, threads, reverse.get() );
+                double elapsed = chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count();
+
+                //봮еĽͬÿĸǡñһ
+                bool correct = ( d == expected );
+                for ( size_t i = 1; i < n && correct; ++i )
+                {
+                    if ( d[i] != numeric_limits<int>::max() )
+                    {
+                        correct = ( parent_index[i] >= 0 && d[parent_index[i]] + 1 == d[i] && g.IsLinked( parent_index[i], i ).first );
+                    }
+                }
+                cout << "    Ż" << threads << "̣߳" << elapsed << "ms" << reached << "㣬" << ( correct ? "ȷ" : "" ) << endl;
+            }
+        }
     }
 }
\ No newline at end of file
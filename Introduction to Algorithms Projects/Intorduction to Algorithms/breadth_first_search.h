@@ -0,0 +1,282 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		breadth_first_search.h
+/// @brief		ŻĲй
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <limits>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include "graphics.h"
+#include "parallel_for.h"
+
+using namespace std;
+
+namespace ita
+{
+    namespace detail
+    {
+        /// λͼеiλǷΪ1
+        inline bool _TestBit( vector<uint64_t> const &bits, size_t i )
+        {
+            return ( ( bits[i >> 6] >> ( i & 63 ) ) & 1 ) != 0;
+        }
+    }
+
+    /// @brief Żdirection-optimizingĲй
+    ///
+    /// ͬؽУÿһɶ̹߳ͬӵǰǰأfrontierһǰءÿһѡ֮һ
+    /// - Զ£ɨǰÿĳߣԭӵfetch_orռδʵھӣ߳dparentԼ˽еһУ
+    /// - ԵϣɨÿδʵĶߣֻҪҵһǰλͼеǰdparentֹͣɨ衣
+    ///   ̰߳64һ飨λͼеһ֣ȡ㣬һǰصλͼÿֻһ߳дҪԭӲ
+    ///
+    /// ǰغСʱԶ¼ùֱС罻磬м伸ǰذ˴󲿷ֶ㣬
+    /// ʱδʵĶкܿҵһǰԵϼıԶԶ¡
+    /// лʱBeamer˵ʽ
+    /// - ǰصĳm_fδʶım_u1/14ʱΪԵϣ
+    /// - ǰصĶС|V|/24ǰСʱĻԶ¡
+    ///
+    /// ͼ߾ǳߣͼҪһReverseAdjacencyͬһͼʱӦɵ߹һβ룬
+    /// ڵһҪԵʱʱһ
+    /// @param	g				ͼGraphicsViaAdjacencyListGraphicsViaCompressedSparseRow
+    /// @param	start_index		㿪ʼй
+    /// @param	d				㷨d[i]Ϊstart_indexiıɴĶΪnumeric_limits<int>::max()
+    /// @param	parent_index	㷨parent_index[i]Ϊжiĸ㣬start_index벻ɴĶΪ-1
+    /// @param	thread_count	̵߳ĸ
+    /// @param	reverse_view	ͼķڽͼΪ
+    /// @return					start_indexɴĶĸstart_indexԼ
+    template<typename GraphType>
+    size_t ParallelBreadthFirstSearch( GraphType const &g, size_t start_index, vector<int> &d, vector<int> &parent_index, size_t thread_count = thread::hardware_concurrency(), ReverseAdjacency const *reverse_view = nullptr )
+    {
+        size_t const n = g.GetVertex().size();
+        size_t const word_count = ( n + 63 ) / 64;
+        size_t const grain = 1024;
+        thread_count = max( thread_count, static_cast<size_t>( 1 ) );
+
+        d.assign( n, numeric_limits<int>::max() );
+        parent_index.assign( n, -1 );
+        if ( start_index >= n )
+        {
+            return 0;
+        }
+
+        //ÿĳȣԼбߵ
+        vector<size_t> degree( n );
+        vector<size_t> worker_sum( thread_count, 0 );
+        ParallelFor( n, grain, thread_count, [&]( size_t worker, size_t begin, size_t end )
+        {
+            size_t sum = 0;
+            for ( size_t u = begin; u < end; ++u )
+            {
+                size_t count = 0;
+                for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+                {
+                    ++count;
+                }
+                degree[u] = count;
+                sum += count;
+            }
+            worker_sum[worker] += sum;
+        } );
+        size_t unexplored_edges = 0;
+        for ( size_t i = 0; i < thread_count; ++i )
+        {
+            unexplored_edges += worker_sum[i];
+        }
+
+        //ѷʵĶλͼԶʱ̻߳ͬʱͬһеĲͬλ
+        unique_ptr<atomic<uint64_t>[]> visited( new atomic<uint64_t>[word_count] );
+        for ( size_t w = 0; w < word_count; ++w )
+        {
+            visited[w].store( 0, memory_order_relaxed );
+        }
+        visited[start_index >> 6].store( static_cast<uint64_t>( 1 ) << ( start_index & 63 ), memory_order_relaxed );
+        d[start_index] = 0;
+
+        unique_ptr<ReverseAdjacency> own_reverse;
+        ReverseAdjacency const *reverse = ( g.GetType() == Digraph ? reverse_view : nullptr );
+        vector<size_t> frontier( 1, start_index );		//Զʱǰ
+        vector<uint64_t> frontier_bits, next_bits;		//Եʱǰ
+        vector<vector<size_t>> next_parts( thread_count );
+        vector<size_t> worker_count( thread_count );
+        bool bottom_up = false;
+        size_t frontier_size = 1;
+        size_t previous_size = 0;
+        size_t frontier_edges = degree[start_index];
+        size_t reached = 1;
+        unexplored_edges -= frontier_edges;
+
+        for ( int level = 0; frontier_size > 0; ++level )
+        {
+            //ѡһķ򣬷ıʱתǰصıʾ
+            if ( !bottom_up && frontier_edges > unexplored_edges / 14 )
+            {
+                bottom_up = true;
+                if ( g.GetType() == Digraph && !reverse )
+                {
+                    own_reverse.reset( new ReverseAdjacency( g ) );
+                    reverse = own_reverse.get();
+                }
+                frontier_bits.assign( word_count, 0 );
+                for ( size_t i = 0; i < frontier.size(); ++i )
+                {
+                    frontier_bits[frontier[i] >> 6] |= static_cast<uint64_t>( 1 ) << ( frontier[i] & 63 );
+                }
+            }
+            else if ( bottom_up && frontier_size < n / 24 && frontier_size < previous_size )
+            {
+                bottom_up = false;
+                frontier.clear();
+                for ( size_t w = 0; w < word_count; ++w )
+                {
+                    uint64_t bits = frontier_bits[w];
+                    for ( size_t bit = 0; bits; ++bit, bits >>= 1 )
+                    {
+                        if ( bits & 1 )
+                        {
+                            frontier.push_back( w * 64 + bit );
+                        }
+                    }
+                }
+            }
+
+            int const next_level = level + 1;
+            fill( worker_sum.begin(), worker_sum.end(), 0 );
+            fill( worker_count.begin(), worker_count.end(), 0 );
+
+            if ( !bottom_up )
+            {
+                ParallelFor( frontier.size(), grain / 16, thread_count, [&]( size_t worker, size_t begin, size_t end )
+                {
+                    vector<size_t> &next = next_parts[worker];
+                    size_t edges = 0;
+                    for ( size_t i = begin; i < end; ++i )
+                    {
+                        size_t u = frontier[i];
+                        for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+                        {
+                            size_t v = it->AimNodeIndex;
+                            uint64_t mask = static_cast<uint64_t>( 1 ) << ( v & 63 );
+                            atomic<uint64_t> &word = visited[v >> 6];
+                            //ȶһΣѾʹĶ㣨ҪԭӵĶ--д
+                            if ( ( word.load( memory_order_relaxed ) & mask ) == 0 && ( word.fetch_or( mask, memory_order_relaxed ) & mask ) == 0 )
+                            {
+                                d[v] = next_level;
+                                parent_index[v] = static_cast<int>( u );
+                                next.push_back( v );
+                                edges += degree[v];
+                            }
+                        }
+                    }
+                    worker_sum[worker] += edges;
+                } );
+
+                frontier.clear();
+                for ( size_t i = 0; i < thread_count; ++i )
+                {
+                    frontier.insert( frontier.end(), next_parts[i].begin(), next_parts[i].end() );
+                    next_parts[i].clear();
+                }
+                previous_size = frontier_size;
+                frontier_size = frontier.size();
+            }
+            else
+            {
+                next_bits.assign( word_count, 0 );
+                ParallelFor( word_count, grain / 64, thread_count, [&]( size_t worker, size_t begin, size_t end )
+                {
+                    size_t edges = 0;
+                    size_t count = 0;
+                    for ( size_t w = begin; w < end; ++w )
+                    {
+                        uint64_t unvisited = ~visited[w].load( memory_order_relaxed );
+                        if ( w + 1 == word_count && ( n & 63 ) != 0 )
+                        {
+                            unvisited &= ( static_cast<uint64_t>( 1 ) << ( n & 63 ) ) - 1;
+                        }
+
+                        uint64_t found = 0;
+                        for ( size_t bit = 0; unvisited; ++bit, unvisited >>= 1 )
+                        {
+                            if ( ( unvisited & 1 ) == 0 )
+                            {
+                                continue;
+                            }
+
+                            size_t v = w * 64 + bit;
+                            size_t parent = n;
+                            if ( reverse )
+                            {
+                                for ( auto it = reverse->PredecessorBegin( v ); it != reverse->PredecessorEnd( v ); ++it )
+                                {
+                                    if ( detail::_TestBit( frontier_bits, *it ) )
+                                    {
+                                        parent = *it;
+                                        break;
+                                    }
+                                }
+                            }
+                            else
+                            {
+                                for ( auto it = g.AdjacentBegin( v ); it != g.AdjacentEnd( v ); ++it )
+                                {
+                                    if ( detail::_TestBit( frontier_bits, it->AimNodeIndex ) )
+                                    {
+                                        parent = it->AimNodeIndex;
+                                        break;
+                                    }
+                                }
+                            }
+
+                            if ( parent != n )
+                            {
+                                d[v] = next_level;
+                                parent_index[v] = static_cast<int>( parent );
+                                found |= static_cast<uint64_t>( 1 ) << bit;
+                                edges += degree[v];
+                                ++count;
+                            }
+                        }
+
+                        //һֻб߳дw
+                        next_bits[w] = found;
+                        visited[w].fetch_or( found, memory_order_relaxed );
+                    }
+                    worker_sum[worker] += edges;
+                    worker_count[worker] += count;
+                } );
+
+                frontier_bits.swap( next_bits );
+                previous_size = frontier_size;
+                frontier_size = 0;
+                for ( size_t i = 0; i < thread_count; ++i )
+                {
+                    frontier_size += worker_count[i];
+                }
+            }
+
+            frontier_edges = 0;
+            for ( size_t i = 0; i < thread_count; ++i )
+            {
+                frontier_edges += worker_sum[i];
+            }
+            unexplored_edges -= frontier_edges;
+            reached += frontier_size;
+        }
+
+        return reached;
+    }
+}
\ No newline at end of file
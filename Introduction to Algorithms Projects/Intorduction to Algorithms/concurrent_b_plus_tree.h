@@ -0,0 +1,555 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		concurrent_b_plus_tree.h
+/// @brief		ֹϣOptimistic Lock CouplingĲB+ߴӲ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <cstdint>
+#include <type_traits>
+#include "node_pool.h"
+using namespace std;
+
+namespace ita
+{
+    /// @brief ֹϣOptimistic Lock CouplingĲB+
+    ///
+    /// B_tree.cppеBTreeBPlusTreeûκβƣ̹߳һʱֻһȫֵ
+    /// д߳ڷѽʱеĲҶҪšConcurrentBPlusTreeÿһ汾ţ
+    /// - 汾ΪżʾûбסΪʾһд޸д߽ʱ汾ټ1ÿ޸Ķʹ汾2
+    /// - ߲ȼ½İ汾ţҪݺټ汾Ƿ仯仯˾˵Ŀǲһµݣ
+    ///   Ӹ¿ʼߴӲдڴ棬Զ֮䲻УҲԶᱻд
+    /// - Ӹߵʱȶӵİ汾ţ֤İ汾ţϣ֤ߵȷʵǹؼڵĺӣ
+    /// - дֹͬ۵ߵҶӣֻҪ޸ĵĽŰѼµİ汾һCASΪдʧܾ¿ʼ
+    /// - ʱڲߵ;оͱѣͬʱֻסĸ㣩Ҷӷʱһпλ
+    ///   κʱһдͬʱס㡣
+    ///
+    /// ɾֻҶԪأϲ㣬ԽһһֱЧֱ
+    /// пܻŸձ޸ĵĽָ룬սͲҪڴջơ\n
+    /// ߶Ŀڱ޸ĵĽ㣬˽еĹؼֵָ֡붼atomicģrelaxedĶд
+    /// x86ͨĶдȫͬɰ汾ϵڴϱ֤һԡ
+    /// @param	KeyType		ؼֵͣǿԭӶдļͣ
+    /// @param	ValueType	ֵͣǿԭӶдļָͣ룩
+    /// @param	NodeBytes	ÿֽӦΪУ64ֽڣı
+    /// @see	class BPlusTree
+    template<typename KeyType, typename ValueType, size_t NodeBytes = 512>
+    class ConcurrentBPlusTree
+    {
+    private:
+        /// н㹲еͷ
+        struct _NodeHeader
+        {
+            atomic<uint64_t>	Version;	///< 汾ţʾдס
+            atomic<uint16_t>	Count;		///< ؼֵĸ
+            bool				IsLeaf;		///< ǷΪҶӽ㣬ٸı
+        };
+
+    public:
+        /// ÿҶӽܴŵĹؼֵĸ
+        static size_t const LeafCapacity = ( NodeBytes - sizeof( _NodeHeader ) ) / ( sizeof( KeyType ) + sizeof( ValueType ) );
+
+        /// ÿڲܴŵĹؼֵĸӵĸ1
+        static size_t const InnerCapacity = ( NodeBytes - sizeof( _NodeHeader ) - sizeof( void * ) ) / ( sizeof( KeyType ) + sizeof( void * ) );
+
+        static_assert( LeafCapacity >= 3 && InnerCapacity >= 3, "NodeBytes̫СзŲ㹻Ĺؼ" );
+        static_assert( NodeBytes % 64 == 0, "NodeBytesӦΪУ64ֽڣı" );
+        static_assert( is_trivially_copyable<KeyType>::value && is_trivially_copyable<ValueType>::value, "ؼֵֺǼ" );
+        static_assert( atomic<KeyType>::is_always_lock_free && atomic<ValueType>::is_always_lock_free, "ؼֵֺԭӶд" );
+
+        /// һÿյB+һյҶӽ
+        ConcurrentBPlusTree() : _size( 0 ), _height( 1 )
+        {
+            _root.store( _NewLeaf(), memory_order_release );
+        }
+
+        /// @brief ҹؼkeyκ
+        ///
+        /// @param	value	ҵʱֵĸ
+        /// @return	Ƿҵ
+        bool Search( KeyType const &key, ValueType &value ) const
+        {
+            bool found = false;
+            for ( size_t attempt = 0; !_TrySearch( key, value, found ); ++attempt )
+            {
+                _Backoff( attempt );
+            }
+            return found;
+        }
+
+        /// @brief һԪ
+        ///
+        /// @return	trueʾµԪأfalseʾؼѾڣֵֻ
+        bool Insert( KeyType const &key, ValueType const &value )
+        {
+            bool inserted = false;
+            for ( size_t attempt = 0; !_TryInsert( key, value, inserted ); ++attempt )
+            {
+                _Backoff( attempt );
+            }
+            return inserted;
+        }
+
+        /// @brief ɾһԪأϲ
+        ///
+        /// @return	ǷɹɾԪ
+        bool Delete( KeyType const &key )
+        {
+            bool deleted = false;
+            for ( size_t attempt = 0; !_TryDelete( key, deleted ); ++attempt )
+            {
+                _Backoff( attempt );
+            }
+            return deleted;
+        }
+
+        /// Ԫصĸ߳ͬʱ޸ʱֻһֵ
+        size_t Size() const
+        {
+            return _size.load( memory_order_relaxed );
+        }
+
+        /// ĸ߶ȣֻһҶӽʱΪ1
+        size_t Height() const
+        {
+            return _height.load( memory_order_relaxed );
+        }
+
+    private:
+        ConcurrentBPlusTree( ConcurrentBPlusTree const & );
+        ConcurrentBPlusTree & operator=( ConcurrentBPlusTree const & );
+
+        /// Ҷӽ㣺Źؼֵֺ
+        struct _LeafNode : public _NodeHeader
+        {
+            atomic<KeyType>		Keys[LeafCapacity];
+            atomic<ValueType>	Values[LeafCapacity];
+        };
+
+        /// ڲ㣺ŷָؼֺͺָ룬Children[i]еĹؼkKeys[i - 1] <= k < Keys[i]
+        struct _InnerNode : public _NodeHeader
+        {
+            atomic<KeyType>			Keys[InnerCapacity];
+            atomic<_NodeHeader *>	Children[InnerCapacity + 1];
+        };
+
+        static_assert( sizeof( _LeafNode ) <= NodeBytes && sizeof( _InnerNode ) <= NodeBytes, "㳬NodeBytesļ" );
+
+        /// ½㵱ǰİ汾ţдסʱfalse
+        static bool _ReadLock( _NodeHeader const *node, uint64_t &version )
+        {
+            version = node->Version.load( memory_order_acquire );
+            return ( version & 1 ) == 0;
+        }
+
+        /// İ汾ǷȻversionӼ°汾һµ
+        static bool _Validate( _NodeHeader const *node, uint64_t version )
+        {
+            atomic_thread_fence( memory_order_acquire );
+            return node->Version.load( memory_order_relaxed ) == version;
+        }
+
+        /// Ѷʱµİ汾Ϊдڴڼ䱻޸Ĺʱfalse
+        static bool _Upgrade( _NodeHeader *node, uint64_t version )
+        {
+            if ( !node->Version.compare_exchange_strong( version, version + 1, memory_order_acquire ) )
+            {
+                return false;
+            }
+            //֮Խݵ޸Ĳڼ߿
+            atomic_thread_fence( memory_order_release );
+            return true;
+        }
+
+        static void _Unlock( _NodeHeader *node )
+        {
+            node->Version.fetch_add( 1, memory_order_release );
+        }
+
+        /// ¿ʼ֮ǰȴǰԣ֮óCPUд߳
+        static void _Backoff( size_t attempt )
+        {
+            if ( attempt >= 8 )
+            {
+                this_thread::yield();
+            }
+        }
+
+        /// keys[0, count)жֲҵһСkeyλ
+        static size_t _LowerBound( atomic<KeyType> const *keys, size_t count, KeyType const &key )
+        {
+            size_t lo = 0, hi = count;
+            while ( lo < hi )
+            {
+                size_t mid = ( lo + hi ) / 2;
+                if ( keys[mid].load( memory_order_relaxed ) < key )
+                {
+                    lo = mid + 1;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+            return lo;
+        }
+
+        /// keys[0, count)жֲҵһkeyλãڲkeyڵĺ
+        static size_t _UpperBound( atomic<KeyType> const *keys, size_t count, KeyType const &key )
+        {
+            size_t lo = 0, hi = count;
+            while ( lo < hi )
+            {
+                size_t mid = ( lo + hi ) / 2;
+                if ( key < keys[mid].load( memory_order_relaxed ) )
+                {
+                    hi = mid;
+                }
+                else
+                {
+                    lo = mid + 1;
+                }
+            }
+            return lo;
+        }
+
+        /// @brief ֹ۵شӸߵkeyڵҶ
+        ///
+        /// ʱversionΪҶӵİ汾ţparentΪҶӵĸ㣨ҶʱΪnullptrparent_versionΪİ汾ţ
+        /// İ汾ڶҶӵİ汾֮ûб֤
+        /// ʱsplit_fullΪtrue˳·ڲѵҪ¿ʼʱnullptr
+        _LeafNode * _FindLeaf( KeyType const &key, uint64_t &version, _InnerNode *&parent, uint64_t &parent_version, bool split_full = false )
+        {
+            _NodeHeader *node = _root.load( memory_order_acquire );
+            if ( !_ReadLock( node, version ) || node != _root.load( memory_order_acquire ) )
+            {
+                return nullptr;
+            }
+
+            parent = nullptr;
+            while ( !node->IsLeaf )
+            {
+                _InnerNode *inner = static_cast<_InnerNode *>( node );
+                size_t count = inner->Count.load( memory_order_relaxed );
+                if ( split_full && count == InnerCapacity )
+                {
+                    _SplitInnerOnPath( inner, version, parent, parent_version );
+                    return nullptr;
+                }
+
+                if ( parent && !_Validate( parent, parent_version ) )
+                {
+                    return nullptr;
+                }
+                parent = inner;
+                parent_version = version;
+
+                //CountܱȺָ£ӻnullptrʱֻ¿ʼ
+                node = inner->Children[_UpperBound( inner->Keys, count, key )].load( memory_order_acquire );
+                if ( !node || !_Validate( inner, parent_version ) || !_ReadLock( node, version ) )
+                {
+                    return nullptr;
+                }
+            }
+            return static_cast<_LeafNode *>( node );
+        }
+
+        bool _TrySearch( KeyType const &key, ValueType &value, bool &found ) const
+        {
+            _NodeHeader *node = _root.load( memory_order_acquire );
+            uint64_t version;
+            if ( !_ReadLock( node, version ) || node != _root.load( memory_order_acquire ) )
+            {
+                return false;
+            }
+
+            while ( !node->IsLeaf )
+            {
+                _InnerNode *inner = static_cast<_InnerNode *>( node );
+                node = inner->Children[_UpperBound( inner->Keys, inner->Count.load( memory_order_relaxed ), key )].load( memory_order_acquire );
+
+                uint64_t child_version;
+                if ( !node || !_Validate( inner, version ) || !_ReadLock( node, child_version ) || !_Validate( inner, version ) )
+                {
+                    return false;
+                }
+                version = child_version;
+            }
+
+            _LeafNode const *leaf = static_cast<_LeafNode const *>( node );
+            size_t count = leaf->Count.load( memory_order_relaxed );
+            size_t pos = _LowerBound( leaf->Keys, count, key );
+            found = pos < count && !( key < leaf->Keys[pos].load( memory_order_relaxed ) );
+            if ( found )
+            {
+                value = leaf->Values[pos].load( memory_order_relaxed );
+            }
+            return _Validate( leaf, version );
+        }
+
+        bool _TryInsert( KeyType const &key, ValueType const &value, bool &inserted )
+        {
+            uint64_t version, parent_version = 0;
+            _InnerNode *parent = nullptr;
+            _LeafNode *leaf = _FindLeaf( key, version, parent, parent_version, true );
+            if ( !leaf )
+            {
+                return false;
+            }
+
+            size_t count = leaf->Count.load( memory_order_relaxed );
+            size_t pos = _LowerBound( leaf->Keys, count, key );
+            bool exists = pos < count && !( key < leaf->Keys[pos].load( memory_order_relaxed ) );
+            if ( !exists && count == LeafCapacity )
+            {
+                //ҶסҶӣ֮¿ʼ
+                if ( parent && !_Upgrade( parent, parent_version ) )
+                {
+                    return false;
+                }
+                if ( !_Upgrade( leaf, version ) )
+                {
+                    if ( parent )
+                    {
+                        _Unlock( parent );
+                    }
+                    return false;
+                }
+                if ( parent || leaf == _root.load( memory_order_relaxed ) )
+                {
+                    KeyType separator;
+                    _NodeHeader *right = _SplitLeaf( leaf, separator );
+                    _LinkRight( parent, leaf, separator, right );
+                }
+                _Unlock( leaf );
+                if ( parent )
+                {
+                    _Unlock( parent );
+                }
+                return false;
+            }
+
+            if ( !_Upgrade( leaf, version ) )
+            {
+                return false;
+            }
+            if ( parent && !_Validate( parent, parent_version ) )
+            {
+                _Unlock( leaf );
+                return false;
+            }
+
+            if ( exists )
+            {
+                leaf->Values[pos].store( value, memory_order_relaxed );
+            }
+            else
+            {
+                for ( size_t i = count; i > pos; --i )
+                {
+                    leaf->Keys[i].store( leaf->Keys[i - 1].load( memory_order_relaxed ), memory_order_relaxed );
+                    leaf->Values[i].store( leaf->Values[i - 1].load( memory_order_relaxed ), memory_order_relaxed );
+                }
+                leaf->Keys[pos].store( key, memory_order_relaxed );
+                leaf->Values[pos].store( value, memory_order_relaxed );
+                leaf->Count.store( static_cast<uint16_t>( count + 1 ), memory_order_relaxed );
+                _size.fetch_add( 1, memory_order_relaxed );
+            }
+            _Unlock( leaf );
+            inserted = !exists;
+            return true;
+        }
+
+        bool _TryDelete( KeyType const &key, bool &deleted )
+        {
+            uint64_t version, parent_version = 0;
+            _InnerNode *parent = nullptr;
+            _LeafNode *leaf = _FindLeaf( key, version, parent, parent_version );
+            if ( !leaf )
+            {
+                return false;
+            }
+
+            size_t count = leaf->Count.load( memory_order_relaxed );
+            size_t pos = _LowerBound( leaf->Keys, count, key );
+            deleted = pos < count && !( key < leaf->Keys[pos].load( memory_order_relaxed ) );
+            if ( !deleted )
+            {
+                //ûҵʱʲôҲ޸ģ֤һ¶һµľ͹
+                return _Validate( leaf, version ) && ( !parent || _Validate( parent, parent_version ) );
+            }
+
+            if ( !_Upgrade( leaf, version ) )
+            {
+                return false;
+            }
+            if ( parent && !_Validate( parent, parent_version ) )
+            {
+                _Unlock( leaf );
+                return false;
+            }
+
+            for ( size_t i = pos; i + 1 < count; ++i )
+            {
+                leaf->Keys[i].store( leaf->Keys[i + 1].load( memory_order_relaxed ), memory_order_relaxed );
+                leaf->Values[i].store( leaf->Values[i + 1].load( memory_order_relaxed ), memory_order_relaxed );
+            }
+            leaf->Count.store( static_cast<uint16_t>( count - 1 ), memory_order_relaxed );
+            _size.fetch_sub( 1, memory_order_relaxed );
+            _Unlock( leaf );
+            return true;
+        }
+
+        /// ;ڲinnerסĸ㣬Ϊ
+        void _SplitInnerOnPath( _InnerNode *inner, uint64_t version, _InnerNode *parent, uint64_t parent_version )
+        {
+            if ( parent && !_Upgrade( parent, parent_version ) )
+            {
+                return;
+            }
+            if ( !_Upgrade( inner, version ) )
+            {
+                if ( parent )
+                {
+                    _Unlock( parent );
+                }
+                return;
+            }
+
+            //ûиʱinnerȻǸѾд߷ѹµĸ
+            if ( parent || inner == _root.load( memory_order_relaxed ) )
+            {
+                _InnerNode *right = _NewInner();
+                size_t half = InnerCapacity / 2;
+                KeyType separator = inner->Keys[half].load( memory_order_relaxed );
+                for ( size_t i = half + 1; i < InnerCapacity; ++i )
+                {
+                    right->Keys[i - half - 1].store( inner->Keys[i].load( memory_order_relaxed ), memory_order_relaxed );
+                }
+                for ( size_t i = half + 1; i <= InnerCapacity; ++i )
+                {
+                    right->Children[i - half - 1].store( inner->Children[i].load( memory_order_relaxed ), memory_order_relaxed );
+                }
+                right->Count.store( static_cast<uint16_t>( InnerCapacity - half - 1 ), memory_order_release );
+                inner->Count.store( static_cast<uint16_t>( half ), memory_order_release );
+                _LinkRight( parent, inner, separator, right );
+            }
+
+            _Unlock( inner );
+            if ( parent )
+            {
+                _Unlock( parent );
+            }
+        }
+
+        /// סҶӵĺһᵽµҶУµҶӣseparatorΪҶСĹؼ
+        _NodeHeader * _SplitLeaf( _LeafNode *leaf, KeyType &separator )
+        {
+            _LeafNode *right = _NewLeaf();
+            size_t half = LeafCapacity / 2;
+            for ( size_t i = half; i < LeafCapacity; ++i )
+            {
+                right->Keys[i - half].store( leaf->Keys[i].load( memory_order_relaxed ), memory_order_relaxed );
+                right->Values[i - half].store( leaf->Values[i].load( memory_order_relaxed ), memory_order_relaxed );
+            }
+            right->Count.store( static_cast<uint16_t>( LeafCapacity - half ), memory_order_relaxed );
+            leaf->Count.store( static_cast<uint16_t>( half ), memory_order_relaxed );
+            separator = right->Keys[0].load( memory_order_relaxed );
+            return right;
+        }
+
+        /// @brief סĽleftѳµֵrightѷָؼֲ뵽סĸparent
+        ///
+        /// parentһûparentΪnullptrʱleftǸһ㡣rightͨreleaseд뷢ȥ
+        /// źָʱһܿݡCountҲreleaseдںָ֮
+        /// ߶CountrelaxedԿȿµĸԶ߶nullptrĺʱ¿ʼ
+        void _LinkRight( _InnerNode *parent, _NodeHeader *left, KeyType const &separator, _NodeHeader *right )
+        {
+            if ( !parent )
+            {
+                _InnerNode *root = _NewInner();
+                root->Keys[0].store( separator, memory_order_relaxed );
+                root->Children[0].store( left, memory_order_relaxed );
+                root->Children[1].store( right, memory_order_relaxed );
+                root->Count.store( 1, memory_order_release );
+                _root.store( root, memory_order_release );
+                _height.fetch_add( 1, memory_order_relaxed );
+                return;
+            }
+
+            size_t count = parent->Count.load( memory_order_relaxed );
+            size_t pos = _UpperBound( parent->Keys, count, separator );
+            for ( size_t i = count; i > pos; --i )
+            {
+                parent->Keys[i].store( parent->Keys[i - 1].load( memory_order_relaxed ), memory_order_relaxed );
+                parent->Children[i + 1].store( parent->Children[i].load( memory_order_relaxed ), memory_order_relaxed );
+            }
+            parent->Keys[pos].store( separator, memory_order_relaxed );
+            parent->Children[pos + 1].store( right, memory_order_release );
+            parent->Count.store( static_cast<uint16_t>( count + 1 ), memory_order_release );
+        }
+
+        _LeafNode * _NewLeaf()
+        {
+            _LeafNode *leaf;
+            {
+                lock_guard<mutex> lock( _pool_lock );
+                leaf = new ( _leaf_pool.Allocate() ) _LeafNode;
+            }
+            leaf->Version.store( 0, memory_order_relaxed );
+            leaf->Count.store( 0, memory_order_relaxed );
+            leaf->IsLeaf = true;
+            for ( size_t i = 0; i < LeafCapacity; ++i )
+            {
+                leaf->Keys[i].store( KeyType(), memory_order_relaxed );
+                leaf->Values[i].store( ValueType(), memory_order_relaxed );
+            }
+            return leaf;
+        }
+
+        _InnerNode * _NewInner()
+        {
+            _InnerNode *inner;
+            {
+                lock_guard<mutex> lock( _pool_lock );
+                inner = new ( _inner_pool.Allocate() ) _InnerNode;
+            }
+            inner->Version.store( 0, memory_order_relaxed );
+            inner->Count.store( 0, memory_order_relaxed );
+            inner->IsLeaf = false;
+            for ( size_t i = 0; i < InnerCapacity; ++i )
+            {
+                inner->Keys[i].store( KeyType(), memory_order_relaxed );
+            }
+            for ( size_t i = 0; i <= InnerCapacity; ++i )
+            {
+                inner->Children[i].store( nullptr, memory_order_relaxed );
+            }
+            return inner;
+        }
+
+        atomic<_NodeHeader *>	_root;			///< 
+        atomic<size_t>			_size;			///< Ԫصĸ
+        atomic<size_t>			_height;		///< ĸ߶
+        mutex					_pool_lock;		///< أֻڷʱ½õ
+        NodePool<_LeafNode, 64, NodeBytes>		_leaf_pool;		///< Ҷӽ
+        NodePool<_InnerNode, 64, NodeBytes>	_inner_pool;	///< ڲ
+    };
+
+    template<typename KeyType, typename ValueType, size_t NodeBytes>
+    size_t const ConcurrentBPlusTree<KeyType, ValueType, NodeBytes>::LeafCapacity;
+
+    template<typename KeyType, typename ValueType, size_t NodeBytes>
+    size_t const ConcurrentBPlusTree<KeyType, ValueType, NodeBytes>::InnerCapacity;
+}
\ No newline at end of file
@@ -0,0 +1,276 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		concurrent_hash_map.h
+/// @brief		ƬĲɢб֧벢в
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include "universal_hash.h"
+#include "swiss_hash_map.h"
+using namespace std;
+
+namespace ita
+{
+    /// @brief ƬĲɢб
+    ///
+    /// UniversalHashTableSwissHashMap̰߳ȫģ̹߳һʱֻһȫֵеĲлˡ\n
+    /// ConcurrentHashMapѹؼֿռ仮ΪɸƬshardÿƬһSwissHashMapԼ
+    /// - һѡȡȫɢкؼĸƬƬڲɢкأ
+    /// - Insert/Delete/SearchֻסؼڵķƬڲͬƬϵĲͬʱУ
+    /// - ÿƬռУͬƬ֮䲻ᷢα
+    /// - BulkInsert/ParallelSearchȰһؼְƬͰɶ߳ȡƬÿƬֻһʹȫؼ֣
+    ///   ̴ͬ߳ķƬͬ˴֮û
+    ///
+    /// ߳ʱ޸ĻɾԪأSearchصֵĸָ롣
+    /// @param	KeyType		ؼֵͣǲ64λ
+    /// @param	ValueType	ֵ
+    /// @see	class SwissHashMap
+    template<typename KeyType, typename ValueType>
+    class ConcurrentHashMap
+    {
+    public:
+        /// @brief һյĲɢб
+        ///
+        /// @param	shard_count			ƬĸᱻȡΪ2
+        /// @param	initial_capacity	ԤƵԪƽƬ
+        explicit ConcurrentHashMap( size_t shard_count = 64, size_t initial_capacity = 0 )
+        {
+            size_t count = 1;
+            while ( count < shard_count )
+            {
+                count *= 2;
+            }
+
+            size_t per_shard = initial_capacity / count + 1;
+            _shards.reserve( count );
+            for ( size_t i = 0; i < count; ++i )
+            {
+                _shards.push_back( new _Shard( per_shard ) );
+            }
+        }
+
+        ~ConcurrentHashMap()
+        {
+            for ( size_t i = 0; i < _shards.size(); ++i )
+            {
+                delete _shards[i];
+            }
+        }
+
+        /// @brief һԪ
+        ///
+        /// @return	trueʾµԪأfalseʾؼѾڣֵֻ
+        bool Insert( KeyType const &key, ValueType const &value )
+        {
+            _Shard &shard = *_shards[_ShardIndex( key )];
+            lock_guard<mutex> lock( shard.Lock );
+            return shard.Table.Insert( key, value );
+        }
+
+        /// @brief ɾһԪ
+        ///
+        /// @return	ǷɹɾԪ
+        bool Delete( KeyType const &key )
+        {
+            _Shard &shard = *_shards[_ShardIndex( key )];
+            lock_guard<mutex> lock( shard.Lock );
+            return shard.Table.Delete( key );
+        }
+
+        /// @brief ɢбһԪ
+        ///
+        /// @param	value	ҵʱֵĸ
+        /// @return	Ƿҵ
+        bool Search( KeyType const &key, ValueType &value ) const
+        {
+            _Shard &shard = *_shards[_ShardIndex( key )];
+            lock_guard<mutex> lock( shard.Lock );
+            ValueType *finded = shard.Table.Search( key );
+            if ( finded )
+            {
+                value = *finded;
+            }
+            return finded != nullptr;
+        }
+
+        /// @brief thread_count߳زitemsеԪ
+        ///
+        /// @return	²Ԫصĸ
+        size_t BulkInsert( vector<pair<KeyType, ValueType>> const &items, size_t thread_count = thread::hardware_concurrency() )
+        {
+            vector<size_t> order, offsets;
+            _BucketByShard( items.size(), [&]( size_t i )
+            {
+                return items[i].first;
+            }, order, offsets );
+
+            atomic<size_t> inserted( 0 );
+            _ForEachShard( thread_count, [&]( size_t s )
+            {
+                size_t count = 0;
+                _Shard &shard = *_shards[s];
+                lock_guard<mutex> lock( shard.Lock );
+                for ( size_t k = offsets[s]; k < offsets[s + 1]; ++k )
+                {
+                    pair<KeyType, ValueType> const &item = items[order[k]];
+                    count += shard.Table.Insert( item.first, item.second );
+                }
+                inserted += count;
+            } );
+            return inserted;
+        }
+
+        /// @brief thread_count̲߳еزkeysейؼ
+        ///
+        /// @param	results	results[i]Ӧkeys[i]firstʾǷҵҵʱsecondΪֵĸ
+        /// @return	ҵĹؼֵĸ
+        size_t ParallelSearch( vector<KeyType> const &keys, vector<pair<bool, ValueType>> &results, size_t thread_count = thread::hardware_concurrency() ) const
+        {
+            vector<size_t> order, offsets;
+            _BucketByShard( keys.size(), [&]( size_t i )
+            {
+                return keys[i];
+            }, order, offsets );
+
+            results.assign( keys.size(), make_pair( false, ValueType() ) );
+            atomic<size_t> found( 0 );
+            _ForEachShard( thread_count, [&]( size_t s )
+            {
+                size_t count = 0;
+                _Shard &shard = *_shards[s];
+                lock_guard<mutex> lock( shard.Lock );
+                for ( size_t k = offsets[s]; k < offsets[s + 1]; ++k )
+                {
+                    ValueType *finded = shard.Table.Search( keys[order[k]] );
+                    if ( finded )
+                    {
+                        results[order[k]] = make_pair( true, *finded );
+                        ++count;
+                    }
+                }
+                found += count;
+            } );
+            return found;
+        }
+
+        /// Ԫصĸ߳ͬʱ޸ʱֻһֵ
+        size_t Size() const
+        {
+            size_t size = 0;
+            for ( size_t i = 0; i < _shards.size(); ++i )
+            {
+                lock_guard<mutex> lock( _shards[i]->Lock );
+                size += _shards[i]->Table.Size();
+            }
+            return size;
+        }
+
+        /// Ƭĸ
+        size_t ShardCount() const
+        {
+            return _shards.size();
+        }
+
+    private:
+        ConcurrentHashMap( ConcurrentHashMap const & );
+        ConcurrentHashMap & operator=( ConcurrentHashMap const & );
+
+        /// @brief һƬ
+        ///
+        /// ǰһУʹڷƬͬһ
+        struct _Shard
+        {
+            char								PaddingFront[64];
+            mutex								Lock;
+            SwissHashMap<KeyType, ValueType>	Table;
+            char								PaddingBack[64];
+
+            explicit _Shard( size_t capacity ) : Table( capacity )
+            {
+
+            }
+        };
+
+        /// ؼķƬ
+        size_t _ShardIndex( KeyType const &key ) const
+        {
+            return static_cast<size_t>( _shard_hash( static_cast<uint64_t>( key ) ) ) & ( _shards.size() - 1 );
+        }
+
+        /// @brief countؼְƬͰ
+        ///
+        /// ƬsĹؼֵ±Ϊorder[offsets[s]], ..., order[offsets[s + 1] - 1]
+        template<typename KeyOf>
+        void _BucketByShard( size_t count, KeyOf key_of, vector<size_t> &order, vector<size_t> &offsets ) const
+        {
+            vector<size_t> shard_of( count );
+            offsets.assign( _shards.size() + 1, 0 );
+            for ( size_t i = 0; i < count; ++i )
+            {
+                shard_of[i] = _ShardIndex( key_of( i ) );
+                ++offsets[shard_of[i] + 1];
+            }
+            for ( size_t s = 0; s < _shards.size(); ++s )
+            {
+                offsets[s + 1] += offsets[s];
+            }
+
+            vector<size_t> next( offsets.begin(), offsets.end() - 1 );
+            order.resize( count );
+            for ( size_t i = 0; i < count; ++i )
+            {
+                order[next[shard_of[i]]++] = i;
+            }
+        }
+
+        /// thread_counṭ߳ȡƬÿƬһfunc
+        template<typename Func>
+        void _ForEachShard( size_t thread_count, Func func ) const
+        {
+            if ( thread_count == 0 )
+            {
+                thread_count = 1;
+            }
+            thread_count = min( thread_count, _shards.size() );
+
+            atomic<size_t> next_shard( 0 );
+            auto worker = [&]()
+            {
+                for ( size_t s = next_shard++; s < _shards.size(); s = next_shard++ )
+                {
+                    func( s );
+                }
+            };
+
+            vector<thread> threads;
+            for ( size_t i = 1; i < thread_count; ++i )
+            {
+                threads.push_back( thread( worker ) );
+            }
+            worker();
+            for ( size_t i = 0; i < threads.size(); ++i )
+            {
+                threads[i].join();
+            }
+        }
+
+        UniversalHashFunction	_shard_hash;	///< ؼĸƬȫɢк
+        vector<_Shard *>		_shards;		///< еķƬΪ2
+    };
+}
\ No newline at end of file
@@ -32,26 +32,48 @@ namespace ita
     /// vһαʱ¼µһʱd[v]vڽӱʱ¼µڶʱf[v]\n
     /// ͼ㷨õʱǶʱкܴİ\n
     /// ¸ϰ㷨õʾʹ2ʱǺúܺõĴ°¼2ʱ֮󣬺ܶණʱƵˣȱĴȣ\n
-    template<typename T>
-    void DeapthFirstSearch( GraphicsViaAdjacencyList<T> &g )
+    template<typename GraphType>
+    void DeapthFirstSearch( GraphType &g )
     {
-        vector<int>		d( g.GetVertex().size() );				//ʱd
-        vector<int>		f( g.GetVertex().size() );				//ʱf
-        vector<bool>	traversed( g.GetVertex().size(), false );	//ʶǷѾ
-        int				time = 0;
+        vector<int>		d;				//ʱd
+        vector<int>		f;				//ʱf
 
-        cout << endl << "ȱ";
-        for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+        //ߣֵȺ¼㣬ͬʱͳƸߵ
+        struct OrderVisitor : public DFSVisitor
         {
-            if ( !traversed[i] )
+            vector<size_t>	Order;
+            size_t			TreeEdges;
+            size_t			BackEdges;
+
+            OrderVisitor() : TreeEdges( 0 ), BackEdges( 0 )
+            {
+
+            }
+
+            void DiscoverVertex( size_t u, int )
+            {
+                Order.push_back( u );
+            }
+
+            void TreeEdge( size_t, size_t )
             {
-                vector<int> ids = DFS_Visit( g, i, d, f, traversed, time );
-                for ( size_t k = 0; k < ids.size(); ++k )
-                {
-                    cout << g.GetVertex()[ids[k]] << "[" << d[ids[k]] << "," << f[ids[k]] << "] ";
-                }
+                ++TreeEdges;
             }
+
+            void BackEdge( size_t, size_t )
+            {
+                ++BackEdges;
+            }
+        } visitor;
+        DFS( g, d, f, visitor );
+
+        cout << endl << "ȱ";
+        for ( size_t k = 0; k < visitor.Order.size(); ++k )
+        {
+            size_t u = visitor.Order[k];
+            cout << g.GetVertex()[u] << "[" << d[u] << "," << f[u] << "] ";
         }
+        cout << endl << "" << visitor.TreeEdges << "" << visitor.BackEdges << "";
 
         cout << endl << "ȱ";
         vector<pair<int, pair<int, int>>> r;
@@ -95,5 +117,21 @@ namespace ita
         g.Link2Vertex( 6, 7 );
 
         DeapthFirstSearch( g );
+
+        GraphicsViaCompressedSparseRow<char> csr( g );
+        DeapthFirstSearch( csr );
+        cout << endl;
+
+        //һΪ100붥ͬݹʵֻջ
+        size_t const n = 1000000;
+        GraphicsViaAdjacencyList<int> chain( vector<int>( n ), Digraph );
+        for ( size_t i = n - 1; i > 0; --i )
+        {
+            chain.Link2Vertex( i - 1, i );
+        }
+        vector<int> d, f;
+        DFSVisitor visitor;
+        DFS( GraphicsViaCompressedSparseRow<int>( chain ), d, f, visitor );
+        cout << "ȱd[" << n - 1 << "] = " << d[n - 1] << "f[0] = " << f[0] << endl;
     }
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 //////////////////////////////////////////////////////////////////////////
 /// @file		deapth_first_search.h
-/// @brief		ĵݹ
+/// @brief		ĺĳʽջӷ߻ص
 /// @details	COPYRIGHT NOTICE
 ///			    Copyright (c) 2011
 ///			    All rights reserved.\n
@@ -27,37 +27,140 @@ using namespace std;
 
 namespace ita
 {
-    /// @brief ȱĵݹ麯
+    /// @brief ķ
     ///
-    /// ӶindexʼȵĹαֻindexԷʵĽindexɵĽ㲻ʡ
-    /// @param	g				Ҫͼʹڽӱıʾ
+    /// еĻصǿյģʹߴֻ¶ĵ¼DFS_VisitԷߵΪģ壬
+    /// صڱڰ󶨲ҿûʹ麯
+    /// - DiscoverVertexuһα֣ңtimeʱd[u]
+    /// - FinishVertexuڽӱϣڣtimeʱf[u]
+    /// - TreeEdge(u, v)ɭеߣžͻᷢv
+    /// - BackEdgevǻɫģvuȣԻͼлصҲᱻΪߣ
+    /// - ForwardOrCrossEdgevѾǺɫģ(u, v)߻߽ߣֻͼг֣
+    struct DFSVisitor
+    {
+        void DiscoverVertex( size_t, int )
+        {
+
+        }
+
+        void FinishVertex( size_t, int )
+        {
+
+        }
+
+        void TreeEdge( size_t, size_t )
+        {
+
+        }
+
+        void BackEdge( size_t, size_t )
+        {
+
+        }
+
+        void ForwardOrCrossEdge( size_t, size_t )
+        {
+
+        }
+    };
+
+    namespace detail
+    {
+        /// ջ֡ԼڽӱһҪı
+        template<typename GraphType>
+        struct _DFSFrame
+        {
+            size_t									Vertex;
+            typename GraphType::AdjacencyIterator	Next;
+        };
+
+        template<typename GraphType, typename Visitor>
+        void _DFS_Visit( GraphType const &g, size_t index, vector<int> &d, vector<int> &f, int &time, Visitor &visitor, vector<_DFSFrame<GraphType>> &stack )
+        {
+            d[index] = ++time;
+            visitor.DiscoverVertex( index, time );
+            _DFSFrame<GraphType> root = { index, g.AdjacentBegin( index ) };
+            stack.push_back( root );
+
+            while ( !stack.empty() )
+            {
+                //ע⣺push_backʹʧЧȡ±
+                size_t top = stack.size() - 1;
+                size_t u = stack[top].Vertex;
+                if ( stack[top].Next == g.AdjacentEnd( u ) )
+                {
+                    //uڽӱ
+                    stack.pop_back();
+                    f[u] = ++time;
+                    visitor.FinishVertex( u, time );
+                    continue;
+                }
+
+                size_t v = stack[top].Next->AimNodeIndex;
+                ++stack[top].Next;
+                if ( d[v] == 0 )
+                {
+                    //ɫ
+                    visitor.TreeEdge( u, v );
+                    d[v] = ++time;
+                    visitor.DiscoverVertex( v, time );
+                    _DFSFrame<GraphType> frame = { v, g.AdjacentBegin( v ) };
+                    stack.push_back( frame );
+                }
+                else if ( f[v] == 0 )
+                {
+                    //ɫvջ
+                    visitor.BackEdge( u, v );
+                }
+                else
+                {
+                    visitor.ForwardOrCrossEdge( u, v );
+                }
+            }
+        }
+    }
+
+    /// @brief Ӷindexʼȱ
+    ///
+    /// ֻindexԷʵĽindexɵĽ㲻ʡ\n
+    /// ʽջݹ飬ջеÿһ֡¼ԼڽӱһҪıߣԼʹһܳҲջ
+    /// ڽӱֻ˳ɨһ飬ܵʱΪO(V+E)ĹͨvisitorĻصʹߡ\n
+    /// ɫʱʾd[v] == 0Ϊɫd[v] != 0f[v] == 0Ϊɫf[v] != 0ΪɫԵ֮ǰdf㣬
+    /// εãͬһɭеĶʱͬһtime
+    /// @param	g				ҪͼGraphicsViaAdjacencyListGraphicsViaCompressedSparseRow
     /// @param	index			index㿪ʼб
     /// @param	d				ʱd
     /// @param	f				ʱf
-    /// @param	traversed		ʶǷѾ
     /// @param	time			ȫʱ䣬ʱdf
-    /// @return			رȱõĽı
-    template<typename T>
-    vector<int> DFS_Visit( GraphicsViaAdjacencyList<T> &g, size_t index, vector<int> &d, vector<int> &f, vector<bool> &traversed, int &time )
+    /// @param	visitor			ߣDFSVisitor
+    template<typename GraphType, typename Visitor>
+    void DFS_Visit( GraphType const &g, size_t index, vector<int> &d, vector<int> &f, int &time, Visitor &visitor )
     {
-        vector<int> this_time_traversed;
-        this_time_traversed.push_back( index );
-        traversed[index] = true;
-        ++time;
-        d[index] = time;
+        vector<detail::_DFSFrame<GraphType>> stack;
+        detail::_DFS_Visit( g, index, d, f, time, visitor, stack );
+    }
 
-        for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+    /// @brief ͼȱŵ˳ѡȡÿĸ
+    ///
+    /// @param	d				㷨Ϊʱd
+    /// @param	f				㷨Ϊʱf
+    /// @param	visitor			ߣDFSVisitor
+    template<typename GraphType, typename Visitor>
+    void DFS( GraphType const &g, vector<int> &d, vector<int> &f, Visitor &visitor )
+    {
+        size_t const n = g.GetVertex().size();
+        d.assign( n, 0 );
+        f.assign( n, 0 );
+        int time = 0;
+
+        //еһջջ֮ǿյ
+        vector<detail::_DFSFrame<GraphType>> stack;
+        for ( size_t i = 0; i < n; ++i )
         {
-            if ( !traversed[i] && g.IsLinked( index, i ).first )
+            if ( d[i] == 0 )
             {
-                vector<int> v = DFS_Visit( g, i, d, f, traversed, time );
-                this_time_traversed.insert( this_time_traversed.end(), v.begin(), v.end() );
+                detail::_DFS_Visit( g, i, d, f, time, visitor, stack );
             }
         }
-
-        ++time;
-        f[index] = time;
-        return this_time_traversed;
     }
-
 }
\ No newline at end of file
@@ -63,5 +63,13 @@ namespace ita
         {
             cout << g.GetVertex()[i] << " | " << d[i] << endl;
         }
+
+        //ڶCSRͼӦõõͬĽ
+        GraphicsViaCompressedSparseRow<char> csr( g );
+        Dijkstra( csr, start_index, d, parent_index );
+        for ( size_t i = 0; i < csr.GetVertex().size(); ++i )
+        {
+            cout << csr.GetVertex()[i] << " | " << d[i] << endl;
+        }
     }
 }
\ No newline at end of file
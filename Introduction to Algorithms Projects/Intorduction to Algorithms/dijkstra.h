@@ -26,6 +26,9 @@
 #include <limits>
 #include "graphics.h"
 #include "bellman_ford.h"
+#include "priority_queue.h"
+#include "fibonacci_heap.h"
+#include "pairing_heap.h"
 
 using namespace std;
 
@@ -48,47 +51,50 @@ namespace ita
     /// 	6         S  S  {u}\n
     ///		7         for each vertex v  Adj[u]\n
     ///		8             do RELAX(u, v, w)\n
+    /// ÿEXTRACT-MINֻ֮ɳuıߣdֵСĶͨDecreaseKeyȶеλáڵһαɳʱӣԴ㲻ɴĶ㲻С\n
+    /// ȶģQueueTypeָǵĽӿȫͬ
+    /// - IndexedPriorityQueue<int>ѣĬϣO((V+E)lgV)
+    /// - IndexedFibonacciHeap<int>쳲ѣO(E+VlgV)
+    /// - IndexedPairingHeap<int>ԶѣDecreaseKeyĳСʵͨ졣
+    ///
+    /// @code
+    /// Dijkstra<IndexedPairingHeap<int>>( g, start_index, d, parent_index );
+    /// @endcode
     /// @remarks	Dijkstra㷨ٶͼебߵȨֵǷǸ
-    /// @param	g				ڽӱʾͼ
+    /// @param	g				ڽӱCSRʾͼ
     /// @param	start_index		㶥start_indexе·
     /// @param	d				㷨d[i]洢start_indexi·
     /// @parem	parent_index	¼㷨еĽеѡ㷨parent_index[i]ʾstart_indexi·ĵڶı
-    template<typename T>
-    void Dijkstra( GraphicsViaAdjacencyList<T> &g, int start_index, vector<int> &d, vector<int> &parent_index )
+    template<typename QueueType = IndexedPriorityQueue<int>, typename GraphType>
+    void Dijkstra( GraphType &g, int start_index, vector<int> &d, vector<int> &parent_index )
     {
-        auto edges = g.GetAllEdges();
-
         InitializeSingleSource( g, d, parent_index, start_index );
 
-        auto greater_pred = [&]( int index1, int index2 )
-        {
-            return d[index1] > d[index2];
-        };
+        QueueType Q( g.GetVertex().size() );
+        Q.Push( start_index, 0 );
 
-        //ʹͨȶСԿʹöѺ쳲м
-        vector<int> Q;
-        for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+        while( !Q.IsEmpty() )
         {
-            Q.push_back( i );
-        }
-        make_heap( Q.begin(), Q.end(), greater_pred );
+            size_t u = Q.Top();
+            Q.Pop();
 
-
-        while( !Q.empty() )
-        {
-            for_each( edges.begin(), edges.end(), [&]( pair<size_t, size_t> const & p )
+            //ֻԴuı߽ɳڲ
+            for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
             {
-                if ( p.first == Q[0] )
+                WeightedEdge e = { u, it->AimNodeIndex, it->Weight };
+                if ( Relax( d, parent_index, e ) )
                 {
-                    //дmin_eleı߽ɳڲ
-                    Relax( g, d, parent_index, p.first, p.second );
+                    //d[v]Сˣ൱vȶеȼ
+                    if ( Q.Contains( e.AimNodeIndex ) )
+                    {
+                        Q.DecreaseKey( e.AimNodeIndex, d[e.AimNodeIndex] );
+                    }
+                    else
+                    {
+                        Q.Push( e.AimNodeIndex, d[e.AimNodeIndex] );
+                    }
                 }
-            } );
-
-            //dRelax˸ı䣬൱ڸıȶֵҪؽ
-            swap( Q[0], Q[Q.size() - 1] );
-            Q.pop_back();
-            make_heap( Q.begin(), Q.end(), greater_pred );
+            }
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,478 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		disk_b_plus_tree.h
+/// @brief		ҳļеB+ֱӴеļ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include "page_file.h"
+using namespace std;
+
+namespace ita
+{
+    /// @brief ҳļеB+
+    ///
+    /// 㷨ۡ18BĶǴ̣һһҳֻܰҪٵļҳ
+    /// BTreeBPlusTreeȴֻڴУָ֮ʱֻܰеĹؼ²һ顣\n
+    /// DiskBPlusTreeÿPageFileеһҳ֮ҳıŶָԭرļУ
+    /// - 0ҳԪϢ㡢һҶӡߡԪظѾʹõҳҳҶӽڲ㣻
+    /// - еļʱֻҪ0ҳ֮ĲҰͨڴӳȡҳҪؽ
+    /// - ɨֱӶӳ䣨򻺳أеҳƣ롢ɾҪ޸ĵҳƳ޸ģд뻺أ
+    ///   ˻ߵFlushʱҳдļ
+    ///
+    /// ʱ˾ͷѣBPlusTreeͬɾֻҶȥؼ֣ϲ㣬ճλԺĲ롣
+    /// @param	KeyType		ؼֵͣmemcpyƣ֧<Ƚ
+    /// @param	ValueType	ֵͣmemcpy
+    /// @note	ֻFlush֮󣨻֮󣩣ļеݲһµģҪ֪дǷɹʱӦʽصFlush
+    ///			ʱдʧֻcerrб棬׳쳣
+    /// @see	class BPlusTree
+    /// @see	class PageFile
+    template<typename KeyType, typename ValueType>
+    class DiskBPlusTree
+    {
+    private:
+        /// нҳеͷ
+        struct _PageHeader
+        {
+            uint16_t	IsLeaf;		///< ǷΪҶӽ
+            uint16_t	Count;		///< ؼֵĸ
+        };
+
+    public:
+        /// ÿҶӽܴŵĹؼֵĸ
+        static size_t const LeafCapacity = ( PageFile::PageSize - 32 ) / ( sizeof( KeyType ) + sizeof( ValueType ) );
+
+        /// ÿڲܴŵĹؼֵĸӵĸ1
+        static size_t const InnerCapacity = ( PageFile::PageSize - 32 ) / ( sizeof( KeyType ) + sizeof( uint32_t ) );
+
+        /// @brief һļʱһÿ
+        ///
+        /// @param	path		ļ·
+        /// @param	pool_frames	֡ĸ
+        DiskBPlusTree( string const &path, size_t pool_frames = 64 ) : _file( path, pool_frames )
+        {
+            static_assert( sizeof( _LeafPage ) <= PageFile::PageSize && sizeof( _InnerPage ) <= PageFile::PageSize, "㳬һҳ" );
+            static_assert( sizeof( _Meta ) <= PageFile::PageSize, "ԪϢһҳ" );
+
+            if ( _file.FileSize() == 0 )
+            {
+                //ļ0ҳԪϢ1ҳǿյĸ
+                memcpy( _meta.Magic, _Magic(), sizeof( _meta.Magic ) );
+                _meta.PageSize = static_cast<uint32_t>( PageFile::PageSize );
+                _meta.KeySize = static_cast<uint32_t>( sizeof( KeyType ) );
+                _meta.ValueSize = static_cast<uint32_t>( sizeof( ValueType ) );
+                _meta.PageCount = 1;
+                _meta.Root = _meta.FirstLeaf = _AllocatePage();
+                _meta.Height = 1;
+                _meta.Size = 0;
+
+                _PageBuffer buffer;
+                _InitLeaf( buffer );
+                _file.Store( _meta.Root, &buffer );
+                Flush();
+            }
+            else
+            {
+                if ( _file.FileSize() < PageFile::PageSize )
+                {
+                    throw exception( "ЧB+ļ" );
+                }
+                memcpy( &_meta, _file.Read( 0 ), sizeof( _meta ) );
+                if ( memcmp( _meta.Magic, _Magic(), sizeof( _meta.Magic ) ) != 0
+                        || _meta.PageSize != PageFile::PageSize
+                        || _meta.KeySize != sizeof( KeyType )
+                        || _meta.ValueSize != sizeof( ValueType )
+                        || static_cast<size_t>( _meta.PageCount ) * PageFile::PageSize > _file.FileSize() )
+                {
+                    throw exception( "ЧB+ļ" );
+                }
+            }
+        }
+
+        /// ʱдԪϢҳдʧʱֻcerrб棬׳쳣
+        ~DiskBPlusTree()
+        {
+            try
+            {
+                Flush();
+            }
+            catch ( exception const &e )
+            {
+                cerr << "DiskBPlusTreeʱдʧܣ" << e.what() << endl;
+            }
+        }
+
+        /// @brief ҹؼkey
+        ///
+        /// @param	value	ҵʱֵĸ
+        /// @return	Ƿҵ
+        bool Search( KeyType const &key, ValueType &value )
+        {
+            _LeafPage const *leaf = _Leaf( _FindLeaf( key ) );
+            size_t pos = lower_bound( leaf->Keys, leaf->Keys + leaf->Count, key ) - leaf->Keys;
+            if ( pos < leaf->Count && !( key < leaf->Keys[pos] ) )
+            {
+                value = leaf->Values[pos];
+                return true;
+            }
+            return false;
+        }
+
+        /// @brief һԪ
+        ///
+        /// @return	trueʾµԪأfalseʾؼѾڣֵֻ
+        bool Insert( KeyType const &key, ValueType const &value )
+        {
+            _Path path;
+            uint32_t leaf_id = _FindLeaf( key, &path );
+            _PageBuffer leaf_buffer;
+            _file.Load( leaf_id, &leaf_buffer );
+            _LeafPage *leaf = _AsLeaf( leaf_buffer );
+
+            size_t pos = lower_bound( leaf->Keys, leaf->Keys + leaf->Count, key ) - leaf->Keys;
+            if ( pos < leaf->Count && !( key < leaf->Keys[pos] ) )
+            {
+                leaf->Values[pos] = value;
+                _file.Store( leaf_id, &leaf_buffer );
+                return false;
+            }
+
+            ++_meta.Size;
+            if ( leaf->Count < LeafCapacity )
+            {
+                _InsertIntoLeaf( leaf, pos, key, value );
+                _file.Store( leaf_id, &leaf_buffer );
+                return true;
+            }
+
+            //ҶһᵽµҶ
+            uint32_t right_id = _AllocatePage();
+            _PageBuffer right_buffer;
+            _LeafPage *right = _InitLeaf( right_buffer );
+            size_t half = LeafCapacity / 2;
+            right->Count = static_cast<uint16_t>( LeafCapacity - half );
+            copy( leaf->Keys + half, leaf->Keys + LeafCapacity, right->Keys );
+            copy( leaf->Values + half, leaf->Values + LeafCapacity, right->Values );
+            leaf->Count = static_cast<uint16_t>( half );
+
+            right->Prev = leaf_id;
+            right->Next = leaf->Next;
+            if ( leaf->Next != _Nil() )
+            {
+                _PageBuffer next_buffer;
+                _file.Load( leaf->Next, &next_buffer );
+                _AsLeaf( next_buffer )->Prev = right_id;
+                _file.Store( leaf->Next, &next_buffer );
+            }
+            leaf->Next = right_id;
+
+            if ( pos <= half )
+            {
+                _InsertIntoLeaf( leaf, pos, key, value );
+            }
+            else
+            {
+                _InsertIntoLeaf( right, pos - half, key, value );
+            }
+            _file.Store( leaf_id, &leaf_buffer );
+            _file.Store( right_id, &right_buffer );
+
+            _InsertIntoParent( path, right->Keys[0], right_id );
+            return true;
+        }
+
+        /// @brief ɾһԪ
+        ///
+        /// @return	ǷɹɾԪ
+        bool Delete( KeyType const &key )
+        {
+            uint32_t leaf_id = _FindLeaf( key );
+            _PageBuffer leaf_buffer;
+            _file.Load( leaf_id, &leaf_buffer );
+            _LeafPage *leaf = _AsLeaf( leaf_buffer );
+
+            size_t pos = lower_bound( leaf->Keys, leaf->Keys + leaf->Count, key ) - leaf->Keys;
+            if ( pos == leaf->Count || key < leaf->Keys[pos] )
+            {
+                return false;
+            }
+
+            copy( leaf->Keys + pos + 1, leaf->Keys + leaf->Count, leaf->Keys + pos );
+            copy( leaf->Values + pos + 1, leaf->Values + leaf->Count, leaf->Values + pos );
+            --leaf->Count;
+            --_meta.Size;
+            _file.Store( leaf_id, &leaf_buffer );
+            return true;
+        }
+
+        /// @brief ؼִС˳򣬶Թؼ[lo, hi)еÿһԪصһcallback( key, value )
+        ///
+        /// @return	ʹԪصĸ
+        /// @note	callbackв޸
+        template<typename Callback>
+        size_t Scan( KeyType const &lo, KeyType const &hi, Callback callback )
+        {
+            size_t visited = 0;
+            uint32_t id = _FindLeaf( lo );
+            _LeafPage const *leaf = _Leaf( id );
+            size_t index = lower_bound( leaf->Keys, leaf->Keys + leaf->Count, lo ) - leaf->Keys;
+            for ( ;; )
+            {
+                for ( ; index < leaf->Count; ++index )
+                {
+                    if ( !( leaf->Keys[index] < hi ) )
+                    {
+                        return visited;
+                    }
+                    callback( leaf->Keys[index], leaf->Values[index] );
+                    ++visited;
+                }
+                if ( leaf->Next == _Nil() )
+                {
+                    return visited;
+                }
+                leaf = _Leaf( leaf->Next );
+                index = 0;
+            }
+        }
+
+        /// ԪϢеҳдļ
+        void Flush()
+        {
+            _PageBuffer buffer;
+            memset( &buffer, 0, sizeof( buffer ) );
+            memcpy( &buffer, &_meta, sizeof( _meta ) );
+            _file.Store( 0, &buffer );
+            _file.Flush();
+        }
+
+        /// Ԫصĸ
+        size_t Size() const
+        {
+            return static_cast<size_t>( _meta.Size );
+        }
+
+        /// ĸ߶ȣֻһҶӽʱΪ1
+        size_t Height() const
+        {
+            return _meta.Height;
+        }
+
+        /// Ѿʹõҳ0ҳ
+        size_t PageCount() const
+        {
+            return _meta.PageCount;
+        }
+
+    private:
+        DiskBPlusTree( DiskBPlusTree const & );
+        DiskBPlusTree & operator=( DiskBPlusTree const & );
+
+        /// 0ҳеԪϢ
+        struct _Meta
+        {
+            char		Magic[8];		///< ļ͵ı־
+            uint32_t	PageSize;		///< ҳĴС
+            uint32_t	KeySize;		///< ؼֵֽ
+            uint32_t	ValueSize;		///< ֵֽ
+            uint32_t	Root;			///< ҳ
+            uint32_t	FirstLeaf;		///< ߵҶӽҳ
+            uint32_t	Height;			///< ĸ߶
+            uint32_t	PageCount;		///< Ѿʹõҳ
+            uint64_t	Size;			///< Ԫصĸ
+        };
+
+        /// ҶӽҳPrevNextΪҶӵҳ
+        struct _LeafPage : public _PageHeader
+        {
+            uint32_t	Prev;
+            uint32_t	Next;
+            KeyType		Keys[LeafCapacity];
+            ValueType	Values[LeafCapacity];
+        };
+
+        /// ڲҳChildrenΪӵҳ
+        struct _InnerPage : public _PageHeader
+        {
+            KeyType		Keys[InnerCapacity];
+            uint32_t	Children[InnerCapacity + 1];
+        };
+
+        /// һҳСĻ޸ĽʱȰҳƵ
+        struct _PageBuffer
+        {
+            uint64_t	Data[PageFile::PageSize / sizeof( uint64_t )];
+        };
+
+        /// ӸҶӵ·ϾڲҳţԼÿڲ˵ڼ
+        struct _Path
+        {
+            uint32_t	Pages[64];
+            size_t		Slots[64];
+            size_t		Depth;
+
+            _Path() : Depth( 0 ) {}
+        };
+
+        static char const * _Magic()
+        {
+            return "ITABPTRE";
+        }
+
+        /// ʾûһҳҳţ0ҳԪϢǽ㣩
+        static uint32_t _Nil()
+        {
+            return 0;
+        }
+
+        static _LeafPage * _AsLeaf( _PageBuffer &buffer )
+        {
+            return reinterpret_cast<_LeafPage *>( &buffer );
+        }
+
+        static _InnerPage * _AsInner( _PageBuffer &buffer )
+        {
+            return reinterpret_cast<_InnerPage *>( &buffer );
+        }
+
+        /// bufferʼΪһյҶӽ
+        static _LeafPage * _InitLeaf( _PageBuffer &buffer )
+        {
+            memset( &buffer, 0, sizeof( buffer ) );
+            _LeafPage *leaf = _AsLeaf( buffer );
+            leaf->IsLeaf = 1;
+            leaf->Prev = leaf->Next = _Nil();
+            return leaf;
+        }
+
+        /// bufferʼΪһյڲ
+        static _InnerPage * _InitInner( _PageBuffer &buffer )
+        {
+            memset( &buffer, 0, sizeof( buffer ) );
+            return _AsInner( buffer );
+        }
+
+        /// ֱӶҳΪidҶӽ㣬
+        _LeafPage const * _Leaf( uint32_t id )
+        {
+            return reinterpret_cast<_LeafPage const *>( _file.Read( id ) );
+        }
+
+        /// ļĩβµһҳ
+        uint32_t _AllocatePage()
+        {
+            uint32_t id = _meta.PageCount++;
+            _file.Reserve( _meta.PageCount );
+            return id;
+        }
+
+        /// ӸߵkeyڵҶӽ㣬ҳţpathΪʱ¾·
+        uint32_t _FindLeaf( KeyType const &key, _Path *path = nullptr )
+        {
+            uint32_t id = _meta.Root;
+            for ( uint32_t level = 1; level < _meta.Height; ++level )
+            {
+                _InnerPage const *inner = reinterpret_cast<_InnerPage const *>( _file.Read( id ) );
+                size_t slot = upper_bound( inner->Keys, inner->Keys + inner->Count, key ) - inner->Keys;
+                if ( path )
+                {
+                    path->Pages[path->Depth] = id;
+                    path->Slots[path->Depth] = slot;
+                    ++path->Depth;
+                }
+                id = inner->Children[slot];
+            }
+            return id;
+        }
+
+        /// δҶӽposһԪ
+        static void _InsertIntoLeaf( _LeafPage *leaf, size_t pos, KeyType const &key, ValueType const &value )
+        {
+            copy_backward( leaf->Keys + pos, leaf->Keys + leaf->Count, leaf->Keys + leaf->Count + 1 );
+            copy_backward( leaf->Values + pos, leaf->Values + leaf->Count, leaf->Values + leaf->Count + 1 );
+            leaf->Keys[pos] = key;
+            leaf->Values[pos] = value;
+            ++leaf->Count;
+        }
+
+        /// ѳµֵright_idѷָؼseparator뵽·ϵĸУҪʱһֱѵ
+        void _InsertIntoParent( _Path &path, KeyType separator, uint32_t right_id )
+        {
+            while ( path.Depth > 0 )
+            {
+                --path.Depth;
+                uint32_t parent_id = path.Pages[path.Depth];
+                size_t slot = path.Slots[path.Depth];
+                _PageBuffer parent_buffer;
+                _file.Load( parent_id, &parent_buffer );
+                _InnerPage *parent = _AsInner( parent_buffer );
+
+                if ( parent->Count < InnerCapacity )
+                {
+                    copy_backward( parent->Keys + slot, parent->Keys + parent->Count, parent->Keys + parent->Count + 1 );
+                    copy_backward( parent->Children + slot + 1, parent->Children + parent->Count + 1, parent->Children + parent->Count + 2 );
+                    parent->Keys[slot] = separator;
+                    parent->Children[slot + 1] = right_id;
+                    ++parent->Count;
+                    _file.Store( parent_id, &parent_buffer );
+                    return;
+                }
+
+                //мĹؼһ㣬߸Ϊһ
+                KeyType keys[InnerCapacity + 1];
+                uint32_t children[InnerCapacity + 2];
+                copy( parent->Keys, parent->Keys + slot, keys );
+                keys[slot] = separator;
+                copy( parent->Keys + slot, parent->Keys + InnerCapacity, keys + slot + 1 );
+                copy( parent->Children, parent->Children + slot + 1, children );
+                children[slot + 1] = right_id;
+                copy( parent->Children + slot + 1, parent->Children + InnerCapacity + 1, children + slot + 2 );
+
+                size_t mid = ( InnerCapacity + 1 ) / 2;
+                uint32_t new_id = _AllocatePage();
+                _PageBuffer new_buffer;
+                _InnerPage *new_inner = _InitInner( new_buffer );
+                parent->Count = static_cast<uint16_t>( mid );
+                copy( keys, keys + mid, parent->Keys );
+                copy( children, children + mid + 1, parent->Children );
+                new_inner->Count = static_cast<uint16_t>( InnerCapacity - mid );
+                copy( keys + mid + 1, keys + InnerCapacity + 1, new_inner->Keys );
+                copy( children + mid + 1, children + InnerCapacity + 2, new_inner->Children );
+                _file.Store( parent_id, &parent_buffer );
+                _file.Store( new_id, &new_buffer );
+
+                separator = keys[mid];
+                right_id = new_id;
+            }
+
+            //ѵ˸㣬Ҫ
+            uint32_t root_id = _AllocatePage();
+            _PageBuffer root_buffer;
+            _InnerPage *root = _InitInner( root_buffer );
+            root->Count = 1;
+            root->Keys[0] = separator;
+            root->Children[0] = _meta.Root;
+            root->Children[1] = right_id;
+            _file.Store( root_id, &root_buffer );
+            _meta.Root = root_id;
+            ++_meta.Height;
+        }
+
+        PageFile	_file;		///< нҳļ
+        _Meta		_meta;		///< ԪϢFlushʱд0ҳ
+    };
+}
\ No newline at end of file
@@ -101,6 +101,33 @@ namespace ita
 
             cout << endl << endl;
 
+            //ϲѣotherеĽתƸhhͷ
+            FibonacciHeap<string, uint> other;
+            other.insert( "x", 3 );
+            other.insert( "y", 1 );
+            h.insert( "z", 2 );
+            h.merge( other );
+            while ( !h.empty() )
+            {
+                cout << "min=" << *h.minimum() << endl;
+                h.removeMinimum();
+            }
+
+            //أزɾɾĽᱻãռõڴ治һֱ
+            FibonacciHeap<uint, uint> timers;
+            for ( uint round = 0; round < 10000; ++round )
+            {
+                for ( uint i = 0; i < 100; ++i )
+                {
+                    timers.insert( i, ( round * 7919 + i * 104729 ) % 100000 );
+                }
+                for ( uint i = 0; i < 100; ++i )
+                {
+                    timers.removeMinimum();
+                }
+            }
+            cout << "100βɾ֮󣬽ص" << timers.nodeCapacity() << endl;
+
         }
         catch ( string s )
         {
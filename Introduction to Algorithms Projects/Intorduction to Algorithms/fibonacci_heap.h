@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <vector>
 #include <string>
+#include "node_pool.h"
 using namespace std;
 
 namespace ita
@@ -181,6 +182,10 @@ namespace ita
         PNode rootWithMinKey; // a circular d-list of nodes
         uint count;      // total number of elements in heap
         uint maxDegree;  // maximum degree (=child count) of a root in the  circular d-list
+        NodePool<FibonacciHeapNode<Data, Key> > nodePool; // owns all nodes: allocated in contiguous slabs, recycled on removal, released in bulk
+
+        FibonacciHeap( const FibonacciHeap& ); // not copyable: the nodes belong to nodePool
+        FibonacciHeap& operator=( const FibonacciHeap& );
 
     protected:
         PNode insertNode( PNode newNode )
@@ -203,11 +208,20 @@ namespace ita
         bool debug, debugRemoveMin, debugDecreaseKey;
 
         FibonacciHeap():
-            rootWithMinKey( NULL ), count( 0 ), maxDegree( 0 ), debug( false ), debugRemoveMin( false ) {}
+            rootWithMinKey( NULL ), count( 0 ), maxDegree( 0 ), debug( false ), debugRemoveMin( false ), debugDecreaseKey( false ) {}
 
         ~FibonacciHeap()
         {
-            /* TODO: remove all nodes */
+            // all nodes (including the ones still in the heap) are destroyed and released in bulk by ~NodePool
+        }
+
+        // removes all nodes at once, without consolidating
+        void clear()
+        {
+            nodePool.Clear();
+            rootWithMinKey = NULL;
+            count = 0;
+            maxDegree = 0;
         }
 
         bool empty() const
@@ -215,6 +229,12 @@ namespace ita
             return count == 0;
         }
 
+        // number of nodes the heap can hold without asking the system for more memory
+        size_t nodeCapacity() const
+        {
+            return nodePool.Capacity();
+        }
+
         PNode minimum() const
         {
             if ( !rootWithMinKey )
@@ -231,12 +251,27 @@ namespace ita
                 out << endl;
         }
 
-        void merge ( const FibonacciHeap& other )  // Fibonacci-Heap-Union
+        // Fibonacci-Heap-Union: moves all nodes of other into this heap, other becomes empty
+        void merge ( FibonacciHeap& other )
         {
-            rootWithMinKey->insert( other.rootWithMinKey );
-            if ( !rootWithMinKey || ( other.rootWithMinKey && other.rootWithMinKey->key() < rootWithMinKey->key() ) )
-                this->rootWithMinKey = other.rootWithMinKey;
+            if ( &other == this || !other.rootWithMinKey )
+                return;
+            if ( !rootWithMinKey )
+                rootWithMinKey = other.rootWithMinKey;
+            else
+            {
+                rootWithMinKey->insert( other.rootWithMinKey );
+                if ( other.rootWithMinKey->key() < rootWithMinKey->key() )
+                    rootWithMinKey = other.rootWithMinKey;
+            }
             count += other.count;
+            if ( other.maxDegree > maxDegree )
+                maxDegree = other.maxDegree;
+            nodePool.Splice( other.nodePool ); // the merged nodes are now released by this heap
+
+            other.rootWithMinKey = NULL;
+            other.count = 0;
+            other.maxDegree = 0;
         }
 
         PNode insert ( Data d, Key k )
@@ -244,7 +279,7 @@ namespace ita
             if ( debug ) cout << "insert " << d << ":" << k << endl;
             count++;
             // create a new tree with a single myKey:
-            return insertNode( new FibonacciHeapNode<Data, Key>( d, k ) );
+            return insertNode( new ( nodePool.Allocate() ) FibonacciHeapNode<Data, Key>( d, k ) );
         }
 
 
@@ -288,6 +323,7 @@ namespace ita
                 if ( debugRemoveMin ) cout << "  removed the last" << endl;
                 if ( count != 0 )
                     throw string ( "Internal error: should have 0 keys" );
+                nodePool.Release( rootWithMinKey );
                 rootWithMinKey = NULL;
                 return;
             }
@@ -330,7 +366,7 @@ namespace ita
             while ( currentPointer != rootWithMinKey );
 
             /// Phase 3: remove the current root, and calcualte the new rootWithMinKey:
-            delete rootWithMinKey;
+            nodePool.Release( rootWithMinKey );
             rootWithMinKey = NULL;
 
             uint newMaxDegree = 0;
@@ -415,4 +451,80 @@ namespace ita
     };  // FibonacciHeap
 
 
+    /// @brief 쳲ѣСѣ
+    ///
+    /// FibonacciHeapװIndexedPriorityQueueͬĽӿڣԪ[0, capacity)Χڵıţ
+    /// insertصĽָ밴űΪDecreaseKeyʱֱʹþҪҡ\n
+    /// 쳲ѵDecreaseKeyǾ̯O(1)ģDijkstraPrimʱʱΪO(E+VlgV)
+    /// @see	class IndexedPriorityQueue
+    /// @see	class IndexedPairingHeap
+    template<typename KeyType>
+    class IndexedFibonacciHeap
+    {
+    public:
+        /// һյ쳲ѣɱΪ[0, capacity)Ԫ
+        explicit IndexedFibonacciHeap( size_t capacity ) : _handles( capacity, nullptr )
+        {
+
+        }
+
+        /// ΪindexԪԼֵkeyӣҪindexڶ
+        void Push( size_t index, KeyType const &key )
+        {
+            _handles[index] = _heap.insert( index, key );
+        }
+
+        /// ֵСԪصı
+        size_t Top() const
+        {
+            return _heap.minimum()->data();
+        }
+
+        /// ֵСԪصļֵ
+        KeyType TopKey() const
+        {
+            return _heap.minimum()->key();
+        }
+
+        /// ֵСԪس
+        void Pop()
+        {
+            _handles[Top()] = nullptr;
+            _heap.removeMinimum();
+        }
+
+        /// ѱΪindexԪصļֵСΪnew_key
+        void DecreaseKey( size_t index, KeyType const &new_key )
+        {
+            //FibonacciHeap::decreaseKeyȵļֵ
+            if ( new_key < _handles[index]->key() )
+            {
+                _heap.decreaseKey( _handles[index], new_key );
+            }
+        }
+
+        /// ΪindexԪǷڶ
+        bool Contains( size_t index ) const
+        {
+            return _handles[index] != nullptr;
+        }
+
+        /// ΪindexԪصļֵ
+        KeyType Key( size_t index ) const
+        {
+            return _handles[index]->key();
+        }
+
+        /// ѯǷΪ
+        bool IsEmpty() const
+        {
+            return _heap.empty();
+        }
+
+    private:
+        FibonacciHeap<size_t, KeyType>					_heap;		///< 쳲ѣݾԪصı
+        vector<FibonacciHeapNode<size_t, KeyType> *>	_handles;	///< _handles[index]ΪindexĽ㣬ڶʱΪnullptr
+    };
+
+
 }
\ No newline at end of file
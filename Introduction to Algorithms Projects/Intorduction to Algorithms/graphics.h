@@ -1,7 +1,7 @@
 #pragma once
 //////////////////////////////////////////////////////////////////////////
 /// @file		graphics.h
-/// @brief		ͼֱʾ1ڽӱ2ڽӾ
+/// @brief		ͼֱʾ1ڽӱ2ڽӾ󷨣3ѹϡУCSR
 /// @details	COPYRIGHT NOTICE
 ///			    Copyright (c) 2011
 ///			    All rights reserved.\n
@@ -17,6 +17,7 @@
 
 #include <vector>
 #include <utility>
+#include <algorithm>
 using namespace std;
 
 namespace ita
@@ -29,6 +30,16 @@ enum GraphicsType :
         Undigraph			///< ͼ
     };
 
+    /// @brief ͼһȨֵı
+    ///
+    /// (, յ, Ȩֵ)Ԫ顣Ҫɳڵ㷨Bellman-FordֱӱԪ飬ҪͨIsLinkedȥزߵȨֵ
+    struct WeightedEdge
+    {
+        size_t			StartNodeIndex;	///< ı
+        size_t			AimNodeIndex;	///< յı
+        double			Weight;			///< ߵȨֵ
+    };
+
     /// ʹڽӱʾһͼ
     template<typename T>
     class GraphicsViaAdjacencyList
@@ -42,6 +53,53 @@ enum GraphicsType :
             AdjacencyListNode	*Next;			///< ָһ
         };
 
+        /// @brief ĳгߵĵ
+        ///
+        /// GraphicsViaCompressedSparseRow::AdjacencyIterator÷һ£ʹͼ㷨Բͼľʾ
+        /// @code
+        /// for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+        /// {
+        ///     //it->AimNodeIndex, it->Weight
+        /// }
+        /// @endcode
+        class AdjacencyIterator
+        {
+        public:
+            AdjacencyIterator( AdjacencyListNode *node = nullptr ) : _node( node )
+            {
+
+            }
+
+            AdjacencyListNode * operator->() const
+            {
+                return _node;
+            }
+
+            AdjacencyListNode & operator*() const
+            {
+                return *_node;
+            }
+
+            AdjacencyIterator & operator++()
+            {
+                _node = _node->Next;
+                return *this;
+            }
+
+            bool operator==( AdjacencyIterator const &other ) const
+            {
+                return _node == other._node;
+            }
+
+            bool operator!=( AdjacencyIterator const &other ) const
+            {
+                return _node != other._node;
+            }
+
+        private:
+            AdjacencyListNode	*_node;		///< ǰָڽӱ
+        };
+
     public:
         /// ͨʼһͼ
         GraphicsViaAdjacencyList( vector<T> const &v, GraphicsType type ) : _v( v ), _e( v.size(), nullptr ), _type( type )
@@ -106,14 +164,44 @@ enum GraphicsType :
             return _v;
         }
 
+        /// еĶ
+        inline vector<T> const & GetVertex() const
+        {
+            return _v;
+        }
+
         /// еıߵڽӱ
         inline vector<AdjacencyListNode *> & GetEdges()
         {
             return _e;
         }
 
+        /// еıߵڽӱ
+        inline vector<AdjacencyListNode *> const & GetEdges() const
+        {
+            return _e;
+        }
+
+        /// ͼ
+        inline GraphicsType GetType() const
+        {
+            return _type;
+        }
+
+        /// indexĵһ
+        inline AdjacencyIterator AdjacentBegin( size_t index ) const
+        {
+            return AdjacencyIterator( _e[index] );
+        }
+
+        /// indexһ֮λ
+        inline AdjacencyIterator AdjacentEnd( size_t ) const
+        {
+            return AdjacencyIterator();
+        }
+
         /// еıߵıֵ
-        vector<pair<size_t, size_t>> GetAllEdges()
+        vector<pair<size_t, size_t>> GetAllEdges() const
         {
             vector<pair<size_t, size_t>> edges;
             for ( size_t i = 0; i < _e.size(); ++i )
@@ -128,6 +216,21 @@ enum GraphicsType :
             return edges;
         }
 
+        /// еıߵ(, յ, Ȩֵ)Ԫ
+        vector<WeightedEdge> GetAllWeightedEdges() const
+        {
+            vector<WeightedEdge> edges;
+            for ( size_t i = 0; i < _e.size(); ++i )
+            {
+                for ( AdjacencyListNode *l = _e[i]; l; l = l->Next )
+                {
+                    WeightedEdge e = { i, l->AimNodeIndex, l->Weight };
+                    edges.push_back( e );
+                }
+            }
+            return edges;
+        }
+
 
     private:
         //GraphicsViaAdjacencyList(GraphicsViaAdjacencyList<T> const &);
@@ -139,6 +242,212 @@ enum GraphicsType :
     };
 
 
+
+    /// @brief ʹѹϡУCompressed Sparse Rowʾһͼ
+    ///
+    /// ڽӱеÿһ߶ǵnewĽ㣬ʱҪڶصתָ룬ڴͼ˵cache missҪԴ\n
+    /// CSRеı߰˳һУiгλ[_offsets[i], _offsets[i + 1])ڣ
+    /// ˱һڽӱֻ˳ɨһڴ档\n
+    /// CSRͼһɾֻģLink2VertexʺڡڽӱͼȻ󶳽ͼ㷨ĳ
+    /// @note	ÿĳ߰Ŀ궥ıźIsLinkedʹöֲ
+    template<typename T>
+    class GraphicsViaCompressedSparseRow
+    {
+    public:
+        /// CSRеһ
+        struct AdjacencyEdge
+        {
+            size_t			AimNodeIndex;	///< Ŀ궥ı
+            double			Weight;			///< ߵȨֵ
+        };
+
+        /// ĳгߵĵָָ
+        typedef AdjacencyEdge const *		AdjacencyIterator;
+
+    public:
+        /// һڽӱʾͼCSRͼ
+        explicit GraphicsViaCompressedSparseRow( GraphicsViaAdjacencyList<T> const &g )
+            : _v( g.GetVertex() ), _offsets( g.GetVertex().size() + 1, 0 ), _type( g.GetType() )
+        {
+            //һ飺ͳÿĳȣÿĳڱеʼλ
+            for ( size_t i = 0; i < _v.size(); ++i )
+            {
+                size_t degree = 0;
+                for ( auto it = g.AdjacentBegin( i ); it != g.AdjacentEnd( i ); ++it )
+                {
+                    ++degree;
+                }
+                _offsets[i + 1] = _offsets[i] + degree;
+            }
+
+            //ڶ飺ÿĳ߿ıУĿ궥
+            _edges.resize( _offsets.back() );
+            for ( size_t i = 0; i < _v.size(); ++i )
+            {
+                size_t pos = _offsets[i];
+                for ( auto it = g.AdjacentBegin( i ); it != g.AdjacentEnd( i ); ++it, ++pos )
+                {
+                    _edges[pos].AimNodeIndex = it->AimNodeIndex;
+                    _edges[pos].Weight = it->Weight;
+                }
+                stable_sort( _edges.begin() + _offsets[i], _edges.begin() + _offsets[i + 1], []( AdjacencyEdge const & e1, AdjacencyEdge const & e2 )
+                {
+                    return e1.AimNodeIndex < e2.AimNodeIndex;
+                } );
+            }
+        }
+
+        /// @brief ѯǷ
+        ///
+        /// GraphicsViaAdjacencyList::IsLinkedķֵʽһ£ûͷ<false, nullptr>
+        pair<bool, AdjacencyEdge const *> IsLinked( size_t index1, size_t index2 ) const
+        {
+            AdjacencyEdge const *first = AdjacentBegin( index1 );
+            AdjacencyEdge const *last = AdjacentEnd( index1 );
+            AdjacencyEdge const *pos = lower_bound( first, last, index2, []( AdjacencyEdge const & e, size_t index )
+            {
+                return e.AimNodeIndex < index;
+            } );
+            if ( pos != last && pos->AimNodeIndex == index2 )
+            {
+                return make_pair( true, pos );
+            }
+            return make_pair( false, static_cast<AdjacencyEdge const *>( nullptr ) );
+        }
+
+        /// еĶ
+        inline vector<T> const & GetVertex() const
+        {
+            return _v;
+        }
+
+        /// ͼ
+        inline GraphicsType GetType() const
+        {
+            return _type;
+        }
+
+        /// indexĳ
+        inline size_t Degree( size_t index ) const
+        {
+            return _offsets[index + 1] - _offsets[index];
+        }
+
+        /// indexĵһ
+        inline AdjacencyIterator AdjacentBegin( size_t index ) const
+        {
+            return _edges.data() + _offsets[index];
+        }
+
+        /// indexһ֮λ
+        inline AdjacencyIterator AdjacentEnd( size_t index ) const
+        {
+            return _edges.data() + _offsets[index + 1];
+        }
+
+        /// еıߵıֵ
+        vector<pair<size_t, size_t>> GetAllEdges() const
+        {
+            vector<pair<size_t, size_t>> edges;
+            edges.reserve( _edges.size() );
+            for ( size_t i = 0; i < _v.size(); ++i )
+            {
+                for ( auto it = AdjacentBegin( i ); it != AdjacentEnd( i ); ++it )
+                {
+                    edges.push_back( make_pair( i, it->AimNodeIndex ) );
+                }
+            }
+            return edges;
+        }
+
+        /// еıߵ(, յ, Ȩֵ)Ԫ
+        vector<WeightedEdge> GetAllWeightedEdges() const
+        {
+            vector<WeightedEdge> edges;
+            edges.reserve( _edges.size() );
+            for ( size_t i = 0; i < _v.size(); ++i )
+            {
+                for ( auto it = AdjacentBegin( i ); it != AdjacentEnd( i ); ++it )
+                {
+                    WeightedEdge e = { i, it->AimNodeIndex, it->Weight };
+                    edges.push_back( e );
+                }
+            }
+            return edges;
+        }
+
+    private:
+        vector<T>				_v;			///< ͼĶļ
+        vector<size_t>			_offsets;	///< iĳλ_edges[_offsets[i], _offsets[i + 1])䣬|V|+1
+        vector<AdjacencyEdge>	_edges;		///< еıߣ˳
+        GraphicsType			_type;		///< ͼ
+    };
+
+    /// @brief ͼķڽͼÿߵ㣨ǰ
+    ///
+    /// ߱㷨ԵϵĹǰǿ֧ͨ㷨ֻҪ֪ÿǰ
+    /// ҪƶȨֵһתͼReverseAdjacencyCSRʽֻǰıţ
+    /// vǰλ[PredecessorBegin( v ), PredecessorEnd( v ))ŴСС\n
+    /// GraphicsViaAdjacencyListGraphicsViaCompressedSparseRow죬ʱռ䶼O(V+E)
+    class ReverseAdjacency
+    {
+    public:
+        /// ĳǰĵ
+        typedef size_t const *		PredecessorIterator;
+
+        template<typename GraphType>
+        explicit ReverseAdjacency( GraphType const &g ) : _offsets( g.GetVertex().size() + 1, 0 )
+        {
+            size_t const n = g.GetVertex().size();
+
+            //һ飺ͳÿ
+            for ( size_t u = 0; u < n; ++u )
+            {
+                for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+                {
+                    ++_offsets[it->AimNodeIndex + 1];
+                }
+            }
+            for ( size_t v = 0; v < n; ++v )
+            {
+                _offsets[v + 1] += _offsets[v];
+            }
+
+            //ڶ飺С룬ÿǰȻ
+            _sources.resize( _offsets.back() );
+            vector<size_t> next( _offsets.begin(), _offsets.end() - 1 );
+            for ( size_t u = 0; u < n; ++u )
+            {
+                for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+                {
+                    _sources[next[it->AimNodeIndex]++] = u;
+                }
+            }
+        }
+
+        /// v
+        inline size_t InDegree( size_t v ) const
+        {
+            return _offsets[v + 1] - _offsets[v];
+        }
+
+        /// vĵһǰ
+        inline PredecessorIterator PredecessorBegin( size_t v ) const
+        {
+            return _sources.data() + _offsets[v];
+        }
+
+        /// vһǰ֮λ
+        inline PredecessorIterator PredecessorEnd( size_t v ) const
+        {
+            return _sources.data() + _offsets[v + 1];
+        }
+
+    private:
+        vector<size_t>			_offsets;	///< vǰλ_sources[_offsets[v], _offsets[v + 1])䣬|V|+1
+        vector<size_t>			_sources;	///< ߵ㣬յ˳
+    };
+
     /// ʹڽӾʾһͼ
     template<typename VertexType, typename WeightType>
     class GrpahicsViaAdjacencyMatrix
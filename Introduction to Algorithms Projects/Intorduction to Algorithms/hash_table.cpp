@@ -19,6 +19,17 @@
 #include <iterator>
 #include <iomanip>
 #include <limits>
+#include <string>
+#include <ctime>
+#include <cstdlib>
+#include <unordered_map>
+#include <unordered_set>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include "robin_hood_hash_map.h"
+#include "swiss_hash_map.h"
+#include "concurrent_hash_map.h"
 using namespace std;
 
 
@@ -45,10 +56,11 @@ namespace ita
 	{
 	public:
 		/// һȫɢб,ͬʱһϸƵĺУѡһΪɢк
-		UniversalHashTable()
+		/// @param	m	۵ĸ
+		explicit UniversalHashTable( int m = 10 )
 		{
-			_p = 101;		//һ㹻
-			_m = 10;		//۵ĸ
+			_p = 2147483647;	//һ㹻2^31-1ʹÿһǸintؼֶ[0, p)
+			_m = m;				//۵ĸ
 			_items.resize( _m, nullptr );
 			for ( int i = 0; i < _m; ++i )
 			{
@@ -58,8 +70,9 @@ namespace ita
 			}
 
 			// ȫɢеĻ˼ִ<b>ʼ</b>ʱһϸƵĺУѡһΪɢк
-			_a = rand() % ( _p - 1 ) + 1;
-			_b = rand() % _p;
+			//rand()ֻ15λƴܸ[0, p)
+			_a = static_cast<int>( ( static_cast<long long>( rand() ) * ( RAND_MAX + 1LL ) + rand() ) % ( _p - 1 ) + 1 );
+			_b = static_cast<int>( ( static_cast<long long>( rand() ) * ( RAND_MAX + 1LL ) + rand() ) % _p );
 		}
 
 		~UniversalHashTable()
@@ -165,7 +178,8 @@ namespace ita
 		/// h(a, b, k) = ((a*k + b) mod p) mod m
 		int _HashFunction( T k )
 		{
-			return static_cast<int>( _a * k + _b ) % _p % _m;
+			//a*kintл64λ
+			return static_cast<int>( ( static_cast<long long>( _a ) * k + _b ) % _p % _m );
 		}
 
 
@@ -209,4 +223,315 @@ namespace ita
 		return 0;
 	}
 
+
+	/// ԿѰַɢб
+	int testRobinHoodHashMap()
+	{
+		RobinHoodHashMap<int, int> table;
+		cout << "ʼRobinHoodHashMap[0,10)" << endl;
+		for ( int i = 0; i < 10; ++i )
+		{
+			table.Insert( i, i * i );
+		}
+		table.Display();
+
+		cout << "ʼɾ[0,5)" << endl;
+		for ( int i = 0; i < 5; ++i )
+		{
+			table.Delete( i );
+		}
+		table.Display();
+
+		for ( int i = 0; i < 10; ++i )
+		{
+			auto finded = table.Search( i );
+			cout << "ʼ[" << i << "]";
+			if ( finded )
+			{
+				cout << *finded << endl;
+			}
+			else
+			{
+				cout <<  "δҵ" << endl;
+			}
+		}
+
+		//룬֮Ĳɾн
+		cout << "ʼRobinHoodHashMap[0,100000)" << endl;
+		for ( int i = 0; i < 100000; ++i )
+		{
+			table.Insert( i, i );
+		}
+		int missing = 0;
+		for ( int i = 0; i < 100000; ++i )
+		{
+			auto finded = table.Search( i );
+			if ( !finded || *finded != i )
+			{
+				++missing;
+			}
+		}
+		cout << "Ԫظ" << table.Size() << "۵ĸ" << table.Capacity() << "ʧܵĸ" << missing << endl;
+
+		return 0;
+	}
+
+
+	/// Կֽڷ̽ɢб
+	int testSwissHashMap()
+	{
+		SwissHashMap<int, int> table;
+		cout << "ʼSwissHashMap[0,10)" << endl;
+		for ( int i = 0; i < 10; ++i )
+		{
+			table.Insert( i, i * i );
+		}
+		table.Display();
+
+		cout << "ʼɾ[0,5)" << endl;
+		for ( int i = 0; i < 5; ++i )
+		{
+			table.Delete( i );
+		}
+		table.Display();
+
+		for ( int i = 0; i < 10; ++i )
+		{
+			auto finded = table.Search( i );
+			cout << "ʼ[" << i << "]";
+			if ( finded )
+			{
+				cout << *finded << endl;
+			}
+			else
+			{
+				cout <<  "δҵ" << endl;
+			}
+		}
+
+		return 0;
+	}
+
+	namespace
+	{
+		/// ԳRAND_MAX
+		int BigRand()
+		{
+			return static_cast<int>( ( static_cast<long long>( rand() ) * ( RAND_MAX + 1LL ) + rand() ) & 0x7FFFFFFF );
+		}
+
+		/// ԺΪλfuncõʱ
+		template<typename Func>
+		double TimeIt( Func func )
+		{
+			clock_t start = clock();
+			func();
+			return ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC;
+		}
+
+		/// һнʱʱеĸ
+		void PrintHashBenchmarkLine( string const &name, double insert_time, double search_time, size_t hits )
+		{
+			cout << "    " << setw( 20 ) << left << name << right
+				<< "룺" << setw( 8 ) << insert_time << "ms    "
+				<< "ң" << setw( 8 ) << search_time << "ms    "
+				<< "У" << hits << endl;
+		}
+	}
+
+	/// @brief ȽӷȫɢбSwissHashMapstd::unordered_map
+	///
+	/// ۵ĸ̶Ϊcapacitycapacity*loadͬĹؼֺдң70%Ĳʧܵġ
+	/// ɢбװͬstd::unordered_mapͰͬΪcapacity
+	void HashBenchmark()
+	{
+		size_t const capacity = 1 << 17;
+		size_t const search_count = 2000000;
+		double const loads[] = { 0.5, 0.625, 0.75, 0.875 };
+
+		for ( size_t l = 0; l < sizeof( loads ) / sizeof( loads[0] ); ++l )
+		{
+			size_t n = static_cast<size_t>( capacity * loads[l] );
+
+			//ǰnؼֲɢбnؼʧܵĲ
+			vector<int> keys;
+			unordered_set<int> used;
+			while ( keys.size() < 2 * n )
+			{
+				int key = BigRand();
+				if ( used.insert( key ).second )
+				{
+					keys.push_back( key );
+				}
+			}
+			vector<int> queries( search_count );
+			for ( size_t i = 0; i < search_count; ++i )
+			{
+				queries[i] = ( BigRand() % 10 < 7 ) ? keys[n + BigRand() % n] : keys[BigRand() % n];
+			}
+
+			cout << "װ" << loads[l] << "" << n << "Ԫأ" << capacity << "ۣ" << endl;
+
+			{
+				UniversalHashTable<int> table( static_cast<int>( capacity ) );
+				size_t hits = 0;
+				double insert_time = TimeIt( [&]()
+				{
+					for ( size_t i = 0; i < n; ++i )
+					{
+						table.Insert( keys[i] );
+					}
+				} );
+				double search_time = TimeIt( [&]()
+				{
+					for ( size_t i = 0; i < search_count; ++i )
+					{
+						hits += ( table.Search( queries[i] ) != nullptr );
+					}
+				} );
+				PrintHashBenchmarkLine( "UniversalHashTable", insert_time, search_time, hits );
+			}
+
+			{
+				SwissHashMap<int, int> table( capacity );
+				size_t hits = 0;
+				double insert_time = TimeIt( [&]()
+				{
+					for ( size_t i = 0; i < n; ++i )
+					{
+						table.Insert( keys[i], keys[i] );
+					}
+				} );
+				double search_time = TimeIt( [&]()
+				{
+					for ( size_t i = 0; i < search_count; ++i )
+					{
+						hits += ( table.Search( queries[i] ) != nullptr );
+					}
+				} );
+				PrintHashBenchmarkLine( "SwissHashMap", insert_time, search_time, hits );
+			}
+
+			{
+				unordered_map<int, int> table;
+				table.max_load_factor( 1.0f );
+				table.rehash( capacity );
+				size_t hits = 0;
+				double insert_time = TimeIt( [&]()
+				{
+					for ( size_t i = 0; i < n; ++i )
+					{
+						table.insert( make_pair( keys[i], keys[i] ) );
+					}
+				} );
+				double search_time = TimeIt( [&]()
+				{
+					for ( size_t i = 0; i < search_count; ++i )
+					{
+						hits += ( table.find( queries[i] ) != table.end() );
+					}
+				} );
+				PrintHashBenchmarkLine( "std::unordered_map", insert_time, search_time, hits );
+			}
+		}
+	}
+
+
+	/// @brief ԷƬĲɢб
+	///
+	/// 32߳ͬʱ롢ҡɾԵĹؼֱ֣ʹáһȫ + SwissHashMapConcurrentHashMapȽõʱ䣻
+	/// Ȼ벢в
+	int testConcurrentHashMap()
+	{
+		int const thread_count = 32;
+		int const keys_per_thread = 50000;
+
+		//ÿ̲߳ԼĹؼ֣ÿһͲһѾĹؼ֣ɾһ
+		auto run_workers = [&]( function<void ( int )> worker ) -> double
+		{
+			return TimeIt( [&]()
+			{
+				vector<thread> threads;
+				for ( int t = 0; t < thread_count; ++t )
+				{
+					threads.push_back( thread( worker, t ) );
+				}
+				for ( size_t t = 0; t < threads.size(); ++t )
+				{
+					threads[t].join();
+				}
+			} );
+		};
+
+		mutex global_lock;
+		SwissHashMap<int, int> global_table;
+		double global_time = run_workers( [&]( int t )
+		{
+			int base = t * keys_per_thread;
+			for ( int i = 0; i < keys_per_thread; ++i )
+			{
+				lock_guard<mutex> lock( global_lock );
+				global_table.Insert( base + i, i );
+				global_table.Search( base + i / 2 );
+			}
+			for ( int i = 0; i < keys_per_thread; i += 2 )
+			{
+				lock_guard<mutex> lock( global_lock );
+				global_table.Delete( base + i );
+			}
+		} );
+
+		ConcurrentHashMap<int, int> table;
+		double sharded_time = run_workers( [&]( int t )
+		{
+			int base = t * keys_per_thread;
+			int value;
+			for ( int i = 0; i < keys_per_thread; ++i )
+			{
+				table.Insert( base + i, i );
+				table.Search( base + i / 2, value );
+			}
+			for ( int i = 0; i < keys_per_thread; i += 2 )
+			{
+				table.Delete( base + i );
+			}
+		} );
+
+		cout << thread_count << "̣߳ÿ̲߳" << keys_per_thread << "Ԫزɾһ룺" << endl;
+		cout << "    ȫ + SwissHashMap" << global_time << "msԪظ" << global_table.Size() << endl;
+		cout << "    ConcurrentHashMap" << table.ShardCount() << "Ƭ" << sharded_time << "msԪظ" << table.Size() << endl;
+
+		//[0, 200000)һĹؼѾ
+		vector<pair<int, int>> items;
+		for ( int i = 0; i < 200000; ++i )
+		{
+			items.push_back( make_pair( i, -i ) );
+		}
+		size_t inserted = table.BulkInsert( items );
+		cout << "" << items.size() << "Ԫأ²ĸ" << inserted << "Ԫظ" << table.Size() << endl;
+
+		vector<int> keys;
+		for ( int i = 0; i < 10; ++i )
+		{
+			keys.push_back( i * 30000 );
+		}
+		vector<pair<bool, int>> results;
+		size_t found = table.ParallelSearch( keys, results );
+		cout << "в" << keys.size() << "ؼ֣ҵ" << found << "" << endl;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			cout << "    " << keys[i] << "";
+			if ( results[i].first )
+			{
+				cout << results[i].second << endl;
+			}
+			else
+			{
+				cout << "δҵ" << endl;
+			}
+		}
+
+		return 0;
+	}
+
 }
\ No newline at end of file
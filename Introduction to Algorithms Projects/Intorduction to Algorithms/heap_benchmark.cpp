@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////
+/// @file		heap_benchmark.cpp
+/// @brief		Ƚ϶ѡ쳲ѡԶΪDijkstraPrimȶʱ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <ctime>
+#include <cstdlib>
+#include "graphics.h"
+#include "dijkstra.h"
+#include "prim.h"
+
+using namespace std;
+
+namespace ita
+{
+    namespace
+    {
+        /// ԳRAND_MAX
+        size_t BigRand()
+        {
+            return static_cast<size_t>( rand() ) * ( RAND_MAX + 1u ) + rand();
+        }
+
+        /// һn㡢ԼmߵͼߵȨֵ[1, 100]֮
+        GraphicsViaAdjacencyList<int> * RandomGraph( size_t n, size_t m, GraphicsType type )
+        {
+            GraphicsViaAdjacencyList<int> *g = new GraphicsViaAdjacencyList<int>( vector<int>( n ), type );
+            //һ֤ͼͨ
+            for ( size_t i = 0; i < n; ++i )
+            {
+                g->Link2Vertex( i, ( i + 1 ) % n, static_cast<double>( 1 + BigRand() % 100 ) );
+            }
+            for ( size_t i = n; i < m; ++i )
+            {
+                g->Link2Vertex( BigRand() % n, BigRand() % n, static_cast<double>( 1 + BigRand() % 100 ) );
+            }
+            return g;
+        }
+
+        /// ԺΪλfuncõʱ
+        template<typename Func>
+        double TimeIt( Func func )
+        {
+            clock_t start = clock();
+            func();
+            return ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC;
+        }
+
+        /// ϡͼ߳ͼgϷֱʹȶDijkstraPrimʱ
+        void RunHeapBenchmark( string const &name, size_t n, size_t m )
+        {
+            GraphicsViaAdjacencyList<int> *digraph = RandomGraph( n, m, Digraph );
+            GraphicsViaAdjacencyList<int> *undigraph = RandomGraph( n, m / 2, Undigraph );
+            GraphicsViaCompressedSparseRow<int> dg( *digraph );
+            GraphicsViaCompressedSparseRow<int> ug( *undigraph );
+            delete digraph;
+            delete undigraph;
+
+            vector<int> d1( n ), d2( n ), d3( n ), parent_index( n );
+            double dijkstra_binary = TimeIt( [&]()
+            {
+                Dijkstra<IndexedPriorityQueue<int>>( dg, 0, d1, parent_index );
+            } );
+            double dijkstra_fibonacci = TimeIt( [&]()
+            {
+                Dijkstra<IndexedFibonacciHeap<int>>( dg, 0, d2, parent_index );
+            } );
+            double dijkstra_pairing = TimeIt( [&]()
+            {
+                Dijkstra<IndexedPairingHeap<int>>( dg, 0, d3, parent_index );
+            } );
+
+            vector<int> p1, p2, p3;
+            double prim_binary = TimeIt( [&]()
+            {
+                Prim<IndexedPriorityQueue<double>>( ug, 0, p1 );
+            } );
+            double prim_fibonacci = TimeIt( [&]()
+            {
+                Prim<IndexedFibonacciHeap<double>>( ug, 0, p2 );
+            } );
+            double prim_pairing = TimeIt( [&]()
+            {
+                Prim<IndexedPairingHeap<double>>( ug, 0, p3 );
+            } );
+
+            cout << name << "|V| = " << n << "|E|  " << m << endl;
+            cout << setw( 12 ) << "" << setw( 12 ) << "" << setw( 12 ) << "쳲" << setw( 12 ) << "Զ" << endl;
+            cout << setw( 12 ) << "Dijkstra" << setw( 10 ) << dijkstra_binary << "ms" << setw( 10 ) << dijkstra_fibonacci << "ms" << setw( 10 ) << dijkstra_pairing << "ms" << endl;
+            cout << setw( 12 ) << "Prim" << setw( 10 ) << prim_binary << "ms" << setw( 10 ) << prim_fibonacci << "ms" << setw( 10 ) << prim_pairing << "ms" << endl;
+            if ( d1 != d2 || d1 != d3 )
+            {
+                cout << "ȶеõ·һ£" << endl;
+            }
+        }
+    }
+
+    /// @brief Ƚȶϡͼͼϵ
+    ///
+    /// ϡͼDecreaseKeyĴ٣СĶѺԶռţ
+    /// ͼDecreaseKeyĴӽ|E|쳲ѺԶO(1)DecreaseKeyֳơ
+    void HeapBenchmark()
+    {
+        srand( 2011 );
+        RunHeapBenchmark( "ϡͼ", 200000, 800000 );
+        RunHeapBenchmark( "ͼ", 2000, 2000000 );
+    }
+}
\ No newline at end of file
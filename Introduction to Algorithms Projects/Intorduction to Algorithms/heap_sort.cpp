@@ -117,6 +117,20 @@ namespace ita
 
 		queue.Display();
 
+		cout << "ȶУѱ6ȼᵽߣ" << endl;
+		IndexedPriorityQueue<int> indexed_queue( to_sort.size() );
+		for ( size_t i = 0; i < to_sort.size(); ++i )
+		{
+			indexed_queue.Push( i, to_sort[i] );
+		}
+		indexed_queue.DecreaseKey( 6, -1 );
+		while ( !indexed_queue.IsEmpty() )
+		{
+			cout << indexed_queue.Top() << ":" << indexed_queue.TopKey() << "  ";
+			indexed_queue.Pop();
+		}
+		cout << endl;
+
 		return 0;
 	}
 
@@ -32,12 +32,22 @@ namespace ita
 
     //11£ɢб
     int testHashTable();					//ɢб
+    int testRobinHoodHashMap();				//Ѱַɢб
+    int testSwissHashMap();					//Կֽڷ̽ɢб
+    int testConcurrentHashMap();				//ƬĲɢб
+    void HashBenchmark();					//Ƚϸɢб
 
     //12£
     int testBinarySearchTree();				//
+    void testStaticSearchTree();			//Eytzingervan Emde Boas˳ŵľ̬
 
     //13£
     int testRedBlackTree();					//
+    void testRBTreeSetOperations();			//Join/Splitĺм
+
+    //14£ݽṹ
+    void testOrderStatisticTree();			//˳ͳ
+    void testIntervalTree();				//
 
     //15£̬滮
     void AssembleDispatch();				//װߵ
@@ -53,6 +63,10 @@ namespace ita
 
     //18£B
     void testBTree();						//B
+    void testBPlusTree();					//B+
+    void testDiskBPlusTree();				//ҳļеB+
+    void testConcurrentBPlusTree();			//ֹϵĲB+
+    void ConcurrentBPlusTreeBenchmark();		//ȽȫֹϵB+ڶ߳µ
 
     //19£
     void testBinomialHeaps();				//
@@ -65,9 +79,11 @@ namespace ita
 
     //22£ͼĻ㷨
     void testBreadthFirstSearch();			//ȱ
+    void BreadthFirstSearchBenchmark();		//Ƚϴ뷽ŻĲй
     void testDeapthFirstSearch();			//ȱ
     void TopologicalSort();					//
     void StronglyConnectedComponent();		//ǿ֧ͨ
+    void StronglyConnectedComponentBenchmark();	//ȽKosarajuTarjan벢еǰ㷨
 
     //23£С
     void Kruskal();							//KruskalС㷨
@@ -76,6 +92,7 @@ namespace ita
     //24£Դ·
     bool testBellmanFord();					//BellmanFordԴ·㷨
     void testDijkstra();					//DijkstraԴ·㷨
+    void HeapBenchmark();					//ȽȶDijkstraPrimе
 
     //25£ÿԶ·
     void FloydWarshall();					//FloydWarshallÿԶ·㷨
@@ -103,10 +120,19 @@ int _tmain( int argc, _TCHAR* argv[] )
     //testNthElement();
 
     //testHashTable();
+    //testRobinHoodHashMap();
+    //testSwissHashMap();
+    //testConcurrentHashMap();
+    //HashBenchmark();
 
     //testBinarySearchTree();
+    //testStaticSearchTree();
 
     //testRedBlackTree();
+    //testRBTreeSetOperations();
+
+    //testOrderStatisticTree();
+    //testIntervalTree();
 
     //AssembleDispatch();
     //MatrixListMultiply();
@@ -119,6 +145,10 @@ int _tmain( int argc, _TCHAR* argv[] )
     //HuffmanCode();
 
     //testBTree();
+    //testBPlusTree();
+    //testDiskBPlusTree();
+    //testConcurrentBPlusTree();
+    //ConcurrentBPlusTreeBenchmark();
 
     //testBinomialHeaps();
 
@@ -127,15 +157,18 @@ int _tmain( int argc, _TCHAR* argv[] )
     //testDisjointSetForest();
 
     //testBreadthFirstSearch();
+    //BreadthFirstSearchBenchmark();
     //testDeapthFirstSearch();
     //TopologicalSort();
     //StronglyConnectedComponent();
+    //StronglyConnectedComponentBenchmark();
 
     //Kruskal();
     //Prim();
 
     //testBellmanFord();
     //testDijkstra();
+    //HeapBenchmark();
 
     //FloydWarshall();
     //Johnson();
@@ -72,15 +72,10 @@ namespace ita
 
         //generate g'
         GraphicsViaAdjacencyList<int> gplus( v, Digraph );
-        for ( int i = 0; i < g.GetVertex().size(); ++i )
+        auto edges = g.GetAllWeightedEdges();
+        for ( size_t i = 0; i < edges.size(); ++i )
         {
-            for ( int j = 0; j < g.GetVertex().size(); ++j )
-            {
-                if ( g.IsLinked( i, j ).first )
-                {
-                    gplus.Link2Vertex( i, j, g.IsLinked( i, j ).second->Weight );
-                }
-            }
+            gplus.Link2Vertex( edges[i].StartNodeIndex, edges[i].AimNodeIndex, edges[i].Weight );
         }
         gplus.GetVertex().push_back( 0 );
         gplus.GetEdges().push_back( nullptr );
@@ -98,12 +93,13 @@ namespace ita
             return;
         }
 
-        //re-assign for g
-        auto edges = g.GetAllEdges();
-        for ( int i = 0; i < edges.size(); ++i )
+        //re-assign for gֱÿڽӱ޸ıߵȨֵҪٲұ
+        for ( size_t i = 0; i < g.GetEdges().size(); ++i )
         {
-            auto node = g.IsLinked( edges[i].first, edges[i].second ).second;
-            node->Weight += ( d[edges[i].first] - d[edges[i].second] );
+            for ( auto node = g.GetEdges()[i]; node; node = node->Next )
+            {
+                node->Weight += ( d[i] - d[node->AimNodeIndex] );
+            }
         }
 
         //loop call dijkstra algorithm on g
@@ -0,0 +1,272 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		node_pool.h
+/// @brief		أΪʽݽṹط
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <cstdint>
+using namespace std;
+
+namespace ita
+{
+    /// @brief أslab
+    ///
+    /// ѡЩʽݽṹÿ㶼new/deleteƵĲɾôʱ仨ڴϣҽɢڶѵĸ\n
+    /// NodePoolһϵͳһ飨slabĽռ䣬ÿĴСһ
+    /// - AllocateȴӿȡһյĽ㣬ӵǰ˳гһ㣬O(1)
+    /// - Release㲢ҵϣһAllocateʹãO(1)
+    /// - Clear/ȻĽ㣬ȻеĿһԵػϵͳ
+    ///
+    /// Allocateֻδڴ棬ʹͨplacement new㣬Ĺ캯˽еģֻԪţ
+    /// @code
+    /// NodePool<Node> pool;
+    /// Node *node = new ( pool.Allocate() ) Node( key );
+    /// pool.Release( node );
+    /// @endcode
+    ///
+    /// ÿλõĴСSlotBytessizeof(T)нϴȡAlignmentı׵ַAlignment롣
+    /// ƵĽNodePool<Node, 64, ֽ>䣬ÿ㶼ӻеı߽翪ʼǡռָֽ
+    /// @param	T			
+    /// @param	Alignment	ÿλõĶֽ2ݲҲСTĶҪ
+    /// @param	SlotBytes	ÿλٵֽ
+    /// @note	NodePoolܱƣ֮ͨSpliceתȨ
+    template<typename T, size_t Alignment = alignment_of<T>::value, size_t SlotBytes = sizeof( T )>
+    class NodePool
+    {
+        static_assert( ( Alignment & ( Alignment - 1 ) ) == 0 && Alignment >= alignment_of<T>::value, "Alignment2ݣҲСڽĶҪ" );
+
+    public:
+        /// һյĽأһĴСΪfirst_slab_size
+        explicit NodePool( size_t first_slab_size = 64 )
+            : _free( nullptr ), _used( 0 ), _live( 0 ), _next_slab_size( first_slab_size )
+        {
+
+        }
+
+        ~NodePool()
+        {
+            Clear();
+        }
+
+        /// һģδģڴ
+        T * Allocate()
+        {
+            Slot *slot = _free;
+            if ( slot )
+            {
+                _free = slot->NextFree;
+            }
+            else
+            {
+                if ( _slabs.empty() || _used == _slabs.back().second )
+                {
+                    _NewSlab();
+                }
+                slot = _slabs.back().first + _used++;
+            }
+            ++_live;
+            return reinterpret_cast<T *>( slot->Storage );
+        }
+
+        /// һAllocateĽ㣬ڴ
+        void Release( T *node )
+        {
+            node->~T();
+            Slot *slot = reinterpret_cast<Slot *>( node );
+            slot->NextFree = _free;
+            _free = slot;
+            --_live;
+        }
+
+        /// дĽ㣬ͷеڴ
+        void Clear()
+        {
+            if ( !is_trivially_destructible<T>::value && _live > 0 )
+            {
+                _DestroyLive();
+            }
+            for ( size_t i = 0; i < _blocks.size(); ++i )
+            {
+                delete [] _blocks[i];
+            }
+            _blocks.clear();
+            _slabs.clear();
+            _free = nullptr;
+            _used = 0;
+            _live = 0;
+        }
+
+        /// @brief otherеĽ㣨ĺͿеģתƵ
+        ///
+        /// ںϲݽṹѵUnionϲ֮ԭotherĽɱظͷţotherΪյĽء
+        void Splice( NodePool &other )
+        {
+            if ( &other == this || other._slabs.empty() )
+            {
+                return;
+            }
+
+            //صǰлûгȥĲֹҵϣΪǰϾͲһ
+            _RetireCurrentSlab();
+            other._RetireCurrentSlab();
+
+            while ( other._free )
+            {
+                Slot *slot = other._free;
+                other._free = slot->NextFree;
+                slot->NextFree = _free;
+                _free = slot;
+            }
+
+            //²Ŀǰ棬ʹñһȻѾĿ
+            _slabs.insert( _slabs.begin(), other._slabs.begin(), other._slabs.end() );
+            _blocks.insert( _blocks.end(), other._blocks.begin(), other._blocks.end() );
+            _used = ( _slabs.empty() ? 0 : _slabs.back().second );
+            _live += other._live;
+
+            other._slabs.clear();
+            other._blocks.clear();
+            other._used = 0;
+            other._live = 0;
+        }
+
+        /// otherеĽ㣬O(1)ĵַ
+        void Swap( NodePool &other )
+        {
+            _slabs.swap( other._slabs );
+            _blocks.swap( other._blocks );
+            swap( _free, other._free );
+            swap( _used, other._used );
+            swap( _live, other._live );
+            swap( _next_slab_size, other._next_slab_size );
+        }
+
+        /// ĸ
+        size_t Size() const
+        {
+            return _live;
+        }
+
+        /// пɵĽ
+        size_t Capacity() const
+        {
+            size_t capacity = 0;
+            for ( size_t i = 0; i < _slabs.size(); ++i )
+            {
+                capacity += _slabs[i].second;
+            }
+            return capacity;
+        }
+
+    private:
+        NodePool( NodePool const & );
+        NodePool & operator=( NodePool const & );
+
+        /// @brief еһλ
+        ///
+        /// еλûн㣬Կָ㹲ͬһڴ棬λûκζֶΡ
+        union alignas( Alignment ) Slot
+        {
+            unsigned char	Storage[SlotBytes > sizeof( T ) ? SlotBytes : sizeof( T )];		///< 㱾
+            Slot			*NextFree;		///< ʱָеһλ
+        };
+
+        /// @brief дĽ
+        ///
+        /// λв¼ǷһлûгȥĲ֣һλҪôŴĽ㣬Ҫôڿϡ
+        /// ſѿеλñǳ׵ֲַڵĿ飩ʣµľǴĽ㡣
+        void _DestroyLive()
+        {
+            vector<pair<Slot *, size_t>> order;		//<׵ַ, ı>ַ
+            vector<vector<bool>> is_free( _slabs.size() );
+            for ( size_t i = 0; i < _slabs.size(); ++i )
+            {
+                order.push_back( make_pair( _slabs[i].first, i ) );
+                is_free[i].assign( _slabs[i].second, false );
+            }
+            sort( order.begin(), order.end(), []( pair<Slot *, size_t> const & a, pair<Slot *, size_t> const & b )
+            {
+                return less<Slot *>()( a.first, b.first );
+            } );
+
+            for ( Slot *slot = _free; slot; slot = slot->NextFree )
+            {
+                size_t lo = 0, hi = order.size();
+                while ( hi - lo > 1 )
+                {
+                    size_t mid = ( lo + hi ) / 2;
+                    if ( less<Slot *>()( slot, order[mid].first ) )
+                    {
+                        hi = mid;
+                    }
+                    else
+                    {
+                        lo = mid;
+                    }
+                }
+                is_free[order[lo].second][slot - order[lo].first] = true;
+            }
+
+            for ( size_t i = 0; i < _slabs.size(); ++i )
+            {
+                size_t used = ( i + 1 == _slabs.size() ? _used : _slabs[i].second );
+                for ( size_t k = 0; k < used; ++k )
+                {
+                    if ( !is_free[i][k] )
+                    {
+                        reinterpret_cast<T *>( _slabs[i].first[k].Storage )->~T();
+                    }
+                }
+            }
+        }
+
+        /// ϵͳµһ飬new char[]ֻ֤Ķ룬ԶAlignment - 1ֽڣٰ׵ַ϶
+        void _NewSlab()
+        {
+            char *block = new char[_next_slab_size * sizeof( Slot ) + Alignment - 1];
+            _blocks.push_back( block );
+            Slot *slab = reinterpret_cast<Slot *>( ( reinterpret_cast<uintptr_t>( block ) + Alignment - 1 ) & ~static_cast<uintptr_t>( Alignment - 1 ) );
+            _slabs.push_back( make_pair( slab, _next_slab_size ) );
+            _used = 0;
+            _next_slab_size *= 2;
+        }
+
+        /// ѵǰлûгȥλȫҵ
+        void _RetireCurrentSlab()
+        {
+            if ( _slabs.empty() )
+            {
+                return;
+            }
+            for ( ; _used < _slabs.back().second; ++_used )
+            {
+                Slot *slot = _slabs.back().first + _used;
+                slot->NextFree = _free;
+                _free = slot;
+            }
+        }
+
+        vector<pair<Slot *, size_t>>	_slabs;				///< еĿ飺<׵ַ, нĸ>
+        vector<char *>					_blocks;			///< ϵͳԭʼڴ棬_slabsһһӦ˳һͬ
+        Slot							*_free;				///< 
+        size_t							_used;				///< һѾгȥĽ
+        size_t							_live;				///< ĸ
+        size_t							_next_slab_size;	///< һĴС
+    };
+}
\ No newline at end of file
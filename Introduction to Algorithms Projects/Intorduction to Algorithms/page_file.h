@@ -0,0 +1,319 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		page_file.h
+/// @brief		ҳʵļͨڴӳ䣬дһСĻ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <string>
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace ita
+{
+    /// @brief ҳʵļ
+    ///
+    /// ļΪСΪPageSizeҳҳıŴ0ʼ
+    /// - ļֻʽӳ䵽ڴУһҳֻǷӳеһָ룬ɲϵͳ̭
+    /// - д޸ĵҳƵеһ֡Ϊҳ֮ĶҲ֡ж
+    ///   ʱ̭ûʹõ֡ҳдļFlushеҳдļˢµ̣
+    /// - ҳҳļĴСʱļĴСӳ䡣
+    ///
+    /// Ϊд֮ӳпľµݣӳҪд
+    /// @note	ReadصָһεStoreReserve֮ǰЧ
+    /// @note	Ҫ֪дǷɹʱӦʽصFlushʱдʧܲ׳쳣
+    class PageFile
+    {
+    public:
+        /// ҳĴС
+        static size_t const PageSize = 4096;
+
+        /// @brief һҳļʱһļ
+        ///
+        /// @param	path		ļ·
+        /// @param	pool_frames	֡ĸ
+        PageFile( string const &path, size_t pool_frames = 64 )
+            : _frames( max( pool_frames, static_cast<size_t>( 1 ) ) ), _clock( 0 ), _mapped( nullptr ), _mapped_size( 0 ), _file_size( 0 )
+        {
+#ifdef _WIN32
+            _file = CreateFileA( path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+            if ( _file == INVALID_HANDLE_VALUE )
+            {
+                throw exception( "޷ҳļ" );
+            }
+            LARGE_INTEGER size;
+            GetFileSizeEx( _file, &size );
+            _file_size = static_cast<size_t>( size.QuadPart );
+#else
+            _file = open( path.c_str(), O_RDWR | O_CREAT, 0644 );
+            if ( _file < 0 )
+            {
+                throw exception( "޷ҳļ" );
+            }
+            struct stat st;
+            fstat( _file, &st );
+            _file_size = static_cast<size_t>( st.st_size );
+#endif
+            //ʧʱᱻãӳʧҪرļ
+            try
+            {
+                _Map();
+            }
+            catch ( ... )
+            {
+                _Close();
+                throw;
+            }
+        }
+
+        /// ʱдҳ׳쳣дʧʱֻcerrб棬ļȻᱻر
+        ~PageFile()
+        {
+            try
+            {
+                Flush();
+            }
+            catch ( exception const &e )
+            {
+                cerr << "PageFileʱдʧܣ" << e.what() << endl;
+            }
+            _Unmap();
+            _Close();
+        }
+
+        /// ļֽеҳһѾʹã
+        size_t FileSize() const
+        {
+            return _file_size;
+        }
+
+        /// Ϊidҳ
+        char const * Read( uint32_t id )
+        {
+            unordered_map<uint32_t, size_t>::const_iterator it = _frame_of.find( id );
+            if ( it != _frame_of.end() )
+            {
+                _frames[it->second].LastUsed = ++_clock;
+                return _frames[it->second].Data;
+            }
+            return _mapped + static_cast<size_t>( id ) * PageSize;
+        }
+
+        /// ѱΪidҳƵpage
+        void Load( uint32_t id, void *page )
+        {
+            memcpy( page, Read( id ), PageSize );
+        }
+
+        /// pageݸǱΪidҳµڻ
+        void Store( uint32_t id, void const *page )
+        {
+            _Frame &frame = _frames[_GetFrame( id )];
+            memcpy( frame.Data, page, PageSize );
+            frame.Dirty = true;
+        }
+
+        /// ֤ļpage_countҳҪʱļΪԭ
+        void Reserve( size_t page_count )
+        {
+            if ( page_count * PageSize <= _file_size )
+            {
+                return;
+            }
+
+            size_t new_size = max( _file_size * 2, page_count * PageSize );
+            _Unmap();
+#ifdef _WIN32
+            LARGE_INTEGER size;
+            size.QuadPart = static_cast<LONGLONG>( new_size );
+            SetFilePointerEx( _file, size, nullptr, FILE_BEGIN );
+            SetEndOfFile( _file );
+#else
+            if ( ftruncate( _file, static_cast<off_t>( new_size ) ) != 0 )
+            {
+                throw exception( "޷ҳļ" );
+            }
+#endif
+            _file_size = new_size;
+            _Map();
+        }
+
+        /// еҳдļˢµ
+        void Flush()
+        {
+            for ( size_t i = 0; i < _frames.size(); ++i )
+            {
+                _WriteBack( _frames[i] );
+            }
+#ifdef _WIN32
+            FlushFileBuffers( _file );
+#else
+            fsync( _file );
+#endif
+        }
+
+    private:
+        PageFile( PageFile const & );
+        PageFile & operator=( PageFile const & );
+
+        /// еһ֡
+        struct _Frame
+        {
+            uint32_t	PageId;				///< ֡дŵҳı
+            bool		Used;				///< Ƿһҳ
+            bool		Dirty;				///< Ƿ޸Ĺûдļ
+            uint64_t	LastUsed;			///< һʹõʱ̣LRṶ
+            char		Data[PageSize];		///< ҳ
+
+            _Frame() : PageId( 0 ), Used( false ), Dirty( false ), LastUsed( 0 )
+            {
+
+            }
+        };
+
+        /// ҵűΪidҳ֡ڻʱ̭ûʹõ֡
+        size_t _GetFrame( uint32_t id )
+        {
+            unordered_map<uint32_t, size_t>::const_iterator it = _frame_of.find( id );
+            if ( it != _frame_of.end() )
+            {
+                _frames[it->second].LastUsed = ++_clock;
+                return it->second;
+            }
+
+            size_t victim = 0;
+            for ( size_t i = 1; i < _frames.size(); ++i )
+            {
+                if ( _frames[i].LastUsed < _frames[victim].LastUsed )
+                {
+                    victim = i;
+                }
+            }
+
+            _Frame &frame = _frames[victim];
+            if ( frame.Used )
+            {
+                _WriteBack( frame );
+                _frame_of.erase( frame.PageId );
+            }
+            frame.PageId = id;
+            frame.Used = true;
+            frame.LastUsed = ++_clock;
+            _frame_of[id] = victim;
+            return victim;
+        }
+
+        /// ҳдļ
+        void _WriteBack( _Frame &frame )
+        {
+            if ( !frame.Used || !frame.Dirty )
+            {
+                return;
+            }
+
+            uint64_t offset = static_cast<uint64_t>( frame.PageId ) * PageSize;
+#ifdef _WIN32
+            OVERLAPPED overlapped = {};
+            overlapped.Offset = static_cast<DWORD>( offset );
+            overlapped.OffsetHigh = static_cast<DWORD>( offset >> 32 );
+            DWORD written = 0;
+            if ( !WriteFile( _file, frame.Data, static_cast<DWORD>( PageSize ), &written, &overlapped ) || written != PageSize )
+#else
+            if ( pwrite( _file, frame.Data, PageSize, static_cast<off_t>( offset ) ) != static_cast<ssize_t>( PageSize ) )
+#endif
+            {
+                throw exception( "дҳļʧ" );
+            }
+            frame.Dirty = false;
+        }
+
+        void _Map()
+        {
+            if ( _file_size == 0 )
+            {
+                return;
+            }
+#ifdef _WIN32
+            _mapping = CreateFileMappingA( _file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+            _mapped = _mapping ? static_cast<char *>( MapViewOfFile( _mapping, FILE_MAP_READ, 0, 0, 0 ) ) : nullptr;
+            if ( _mapping && !_mapped )
+            {
+                CloseHandle( _mapping );
+            }
+#else
+            void *address = mmap( nullptr, _file_size, PROT_READ, MAP_SHARED, _file, 0 );
+            _mapped = ( address == MAP_FAILED ) ? nullptr : static_cast<char *>( address );
+#endif
+            if ( !_mapped )
+            {
+                throw exception( "޷ӳҳļ" );
+            }
+            _mapped_size = _file_size;
+        }
+
+        void _Unmap()
+        {
+            if ( !_mapped )
+            {
+                return;
+            }
+#ifdef _WIN32
+            UnmapViewOfFile( _mapped );
+            CloseHandle( _mapping );
+#else
+            munmap( _mapped, _mapped_size );
+#endif
+            _mapped = nullptr;
+            _mapped_size = 0;
+        }
+
+        void _Close()
+        {
+#ifdef _WIN32
+            CloseHandle( _file );
+#else
+            close( _file );
+#endif
+        }
+
+#ifdef _WIN32
+        HANDLE							_file;			///< ļ
+        HANDLE							_mapping;		///< ļӳ
+#else
+        int								_file;			///< ļ
+#endif
+        vector<_Frame>					_frames;		///< 
+        unordered_map<uint32_t, size_t>	_frame_of;		///< ҳı -> ֡
+        uint64_t						_clock;			///< ߼ʱӣÿʹ֡ʱ1
+        char							*_mapped;		///< ļӳ׵ַ
+        size_t							_mapped_size;	///< ӳֽ
+        size_t							_file_size;		///< ļֽ
+    };
+}
\ No newline at end of file
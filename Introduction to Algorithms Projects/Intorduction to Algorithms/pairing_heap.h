@@ -0,0 +1,210 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		pairing_heap.h
+/// @brief		Զ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+using namespace std;
+
+namespace ita
+{
+    /// @brief ԶѣСѣ
+    ///
+    /// ԶһʵĶáֵܡķʽ洢Ĳǳ򵥣
+    /// - Push½ΪһõϲMeldO(1)
+    /// - DecreaseKeyѽͬӸϼϲO(1)̯o(lgn)
+    /// - Popɾ㣬еȴϲٴҵκϲtwo-pass̯O(lgn)
+    ///
+    /// 쳲ѵĽãԶѵĳӺСʵг쳲ѺͶѶҪ졣\n
+    /// IndexedPriorityQueueĽӿͬԪ[0, capacity)Χڵıţн㶼ԤȷһУ
+    /// ֮ͨŶָйвҪκڴ䡣
+    /// @see	class IndexedPriorityQueue
+    /// @see	class IndexedFibonacciHeap
+    template<typename KeyType>
+    class IndexedPairingHeap
+    {
+    public:
+        /// һյԶѣɱΪ[0, capacity)Ԫ
+        explicit IndexedPairingHeap( size_t capacity ) : _nodes( capacity ), _root( _Nil() ), _size( 0 )
+        {
+
+        }
+
+        /// ΪindexԪԼֵkeyӣҪindexڶ
+        void Push( size_t index, KeyType const &key )
+        {
+            PairingHeapNode &node = _nodes[index];
+            node.Key = key;
+            node.Child = node.Sibling = node.Prev = _Nil();
+            node.InHeap = true;
+            _root = _Meld( _root, index );
+            ++_size;
+        }
+
+        /// ֵСԪصı
+        size_t Top() const
+        {
+            return _root;
+        }
+
+        /// ֵСԪصļֵ
+        KeyType const & TopKey() const
+        {
+            return _nodes[_root].Key;
+        }
+
+        /// ֵСԪس
+        void Pop()
+        {
+            size_t old_root = _root;
+            _nodes[old_root].InHeap = false;
+            _root = _MergePairs( _nodes[old_root].Child );
+            _nodes[old_root].Child = _Nil();
+            --_size;
+        }
+
+        /// ѱΪindexԪصļֵСΪnew_key
+        void DecreaseKey( size_t index, KeyType const &new_key )
+        {
+            _nodes[index].Key = new_key;
+            if ( index == _root )
+            {
+                return;
+            }
+
+            //Ӹ㣨ֵܣϼϲ
+            PairingHeapNode &node = _nodes[index];
+            if ( _nodes[node.Prev].Child == index )
+            {
+                _nodes[node.Prev].Child = node.Sibling;
+            }
+            else
+            {
+                _nodes[node.Prev].Sibling = node.Sibling;
+            }
+            if ( node.Sibling != _Nil() )
+            {
+                _nodes[node.Sibling].Prev = node.Prev;
+            }
+            node.Sibling = node.Prev = _Nil();
+            _root = _Meld( _root, index );
+        }
+
+        /// ΪindexԪǷڶ
+        bool Contains( size_t index ) const
+        {
+            return _nodes[index].InHeap;
+        }
+
+        /// ΪindexԪصļֵ
+        KeyType const & Key( size_t index ) const
+        {
+            return _nodes[index].Key;
+        }
+
+        /// ѯǷΪ
+        bool IsEmpty() const
+        {
+            return _size == 0;
+        }
+
+        /// Ԫصĸ
+        size_t Size() const
+        {
+            return _size;
+        }
+
+    private:
+        /// Զеһ
+        struct PairingHeapNode
+        {
+            KeyType		Key;		///< ֵ
+            size_t		Child;		///< һ
+            size_t		Sibling;	///< ֵ
+            size_t		Prev;		///< ֵܣǵһӣΪ
+            bool		InHeap;		///< Ƿڶ
+
+            PairingHeapNode() : Key(), Child( _Nil() ), Sibling( _Nil() ), Prev( _Nil() ), InHeap( false )
+            {
+
+            }
+        };
+
+        /// ʾսı
+        static size_t _Nil()
+        {
+            return static_cast<size_t>( -1 );
+        }
+
+        /// ϲֵϴĸΪֵСĸĵһ
+        size_t _Meld( size_t a, size_t b )
+        {
+            if ( a == _Nil() )
+            {
+                return b;
+            }
+            if ( b == _Nil() )
+            {
+                return a;
+            }
+            if ( _nodes[b].Key < _nodes[a].Key )
+            {
+                std::swap( a, b );
+            }
+
+            _nodes[b].Prev = a;
+            _nodes[b].Sibling = _nodes[a].Child;
+            if ( _nodes[a].Child != _Nil() )
+            {
+                _nodes[_nodes[a].Child].Prev = b;
+            }
+            _nodes[a].Child = b;
+            _nodes[a].Sibling = _nodes[a].Prev = _Nil();
+            return a;
+        }
+
+        /// two-passϲfirstʼֵеغϲĸ
+        size_t _MergePairs( size_t first )
+        {
+            //һ飺ϲ
+            _pairs.clear();
+            while ( first != _Nil() )
+            {
+                size_t a = first;
+                size_t b = _nodes[a].Sibling;
+                first = ( b == _Nil() ? _Nil() : _nodes[b].Sibling );
+
+                _nodes[a].Sibling = _nodes[a].Prev = _Nil();
+                if ( b != _Nil() )
+                {
+                    _nodes[b].Sibling = _nodes[b].Prev = _Nil();
+                }
+                _pairs.push_back( _Meld( a, b ) );
+            }
+
+            //ڶ飺ҵκϲ
+            size_t root = _Nil();
+            for ( size_t i = _pairs.size(); i > 0; --i )
+            {
+                root = _Meld( _pairs[i - 1], root );
+            }
+            return root;
+        }
+
+        vector<PairingHeapNode>		_nodes;		///< еĽ㣬_nodes[index]ǱindexĽ
+        vector<size_t>				_pairs;		///< _MergePairsеһϲĽΪԱÿPopڴ
+        size_t						_root;		///< ıţֵСԪ
+        size_t						_size;		///< Ԫصĸ
+    };
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		parallel_for.h
+/// @brief		һ±ֿ齻̴߳
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+using namespace std;
+
+namespace ita
+{
+    /// @brief thread_count̲߳еش±[0, count)
+    ///
+    /// 䱻гɴСΪgrainĿ飬߳ͨһԭӼȡĳЩĹʱԶ⡣\n
+    /// ÿһһfunc( worker, begin, end )workerΪ̵߳ıţ0...thread_count-1
+    /// ±ÿ߳˽еĻӶѭм\n
+    /// ֻһֻ̻߳һʱֱڵߵִ߳У̡߳
+    template<typename Func>
+    void ParallelFor( size_t count, size_t grain, size_t thread_count, Func func )
+    {
+        grain = max( grain, static_cast<size_t>( 1 ) );
+        size_t chunk_count = ( count + grain - 1 ) / grain;
+        thread_count = min( max( thread_count, static_cast<size_t>( 1 ) ), max( chunk_count, static_cast<size_t>( 1 ) ) );
+
+        atomic<size_t> next_chunk( 0 );
+        auto worker = [&]( size_t worker_index )
+        {
+            for ( size_t c = next_chunk++; c < chunk_count; c = next_chunk++ )
+            {
+                func( worker_index, c * grain, min( count, ( c + 1 ) * grain ) );
+            }
+        };
+
+        vector<thread> threads;
+        for ( size_t i = 1; i < thread_count; ++i )
+        {
+            threads.push_back( thread( worker, i ) );
+        }
+        worker( 0 );
+        for ( size_t i = 0; i < threads.size(); ++i )
+        {
+            threads[i].join();
+        }
+    }
+}
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include <bitset>
 #include <queue>
 #include "graphics.h"
+#include "prim.h"
 
 using namespace std;
 
@@ -31,9 +32,8 @@ namespace ita
 {
     /// @brief PrimС㷨
     ///
-    /// <b>СȨֵn-1ߣеn㣬бϵȨֵС</b>\n\n
-    /// Prim㷨УAγɵ뼯AеİȫһеĶСȨߡ\n
-    /// Prim㷨ȡȶQʵֵģʹ쳲ʵСȶУͿԽPrim㷨ʱĽΪO(E+VlgV)
+    /// P344ҳͼ23-5ֱʹöѡ쳲ѺԶΪȶУõСӦͬ
+    /// @see	Prim( GraphType &, size_t, vector<int> & )
     void Prim()
     {
         cout << "PrimС" << endl;
@@ -42,7 +42,7 @@ namespace ita
         {
             v.push_back( 'a' + i );
         }
-        GrpahicsViaAdjacencyMatrix<char, int> g( v, Undigraph );
+        GraphicsViaAdjacencyList<char> g( v, Undigraph );
         g.Link2Vertex( 0, 1, 4 );
         g.Link2Vertex( 0, 7, 8 );
         g.Link2Vertex( 1, 2, 8 );
@@ -60,36 +60,21 @@ namespace ita
         int start_index = 0;
 
         //parent[i] = jѡȡСʱiһj
-        vector<int> parent( v.size(), -1 );
-        //СеĶļ
-        //pair<ıţöѾСеĶ̾>
-        map<int, int> key;
-        for ( int i = 0; i < g.GetVertex().size(); ++i )
+        vector<int> parent;
+        auto display = [&]( vector<size_t> const & order )
         {
-            key.insert( make_pair( i, numeric_limits<int>::max() ) );
-        }
-        key[start_index] = 0;
-
-        while ( !key.empty() )
-        {
-            //õСⶥСԪ
-            auto min_ele = min_element( key.begin(), key.end(), []( pair<int const, int> &p1, pair<int const, int> &p2 )
+            for ( size_t i = 0; i < order.size(); ++i )
             {
-                return p1.second < p2.second;
-            } );
-            int min_index = min_ele->first;
-            cout << ( parent[min_index] == -1 ? *"&" : g.GetVertex()[parent[min_index]] ) << " -- " << g.GetVertex()[min_index] << endl;
-            key.erase( min_ele );
-
-            for ( int i = 0; i < g.GetVertex().size(); ++i )
-            {
-                if ( key.find( i ) != key.end() && g.IsLinked( i, min_index ) && key[i] > g.GetEdge()[i][min_index] )
-                {
-                    key[i] = g.GetEdge()[i][min_index];
-                    parent[i] = min_index;
-                }
+                int p = parent[order[i]];
+                cout << ( p == -1 ? '&' : g.GetVertex()[p] ) << " -- " << g.GetVertex()[order[i]] << endl;
             }
-        }
+        };
 
+        cout << "ѣ" << endl;
+        display( Prim( g, start_index, parent ) );
+        cout << "쳲ѣ" << endl;
+        display( Prim<IndexedFibonacciHeap<double>>( g, start_index, parent ) );
+        cout << "Զѣ" << endl;
+        display( Prim<IndexedPairingHeap<double>>( g, start_index, parent ) );
     }
 }
\ No newline at end of file
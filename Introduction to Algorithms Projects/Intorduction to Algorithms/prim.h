@@ -0,0 +1,85 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		prim.h
+/// @brief		PrimС㷨
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <limits>
+#include "graphics.h"
+#include "priority_queue.h"
+#include "fibonacci_heap.h"
+#include "pairing_heap.h"
+
+using namespace std;
+
+namespace ita
+{
+    /// @brief PrimС㷨
+    ///
+    /// <b>СȨֵn-1ߣеn㣬бϵȨֵС</b>\n\n
+    /// Prim㷨УAγɵ뼯AеİȫһеĶСȨߡ\n
+    /// ȶдŵڵĶ㣬ֵkey[v]ΪvⶥСߵȨֵÿȡkeyСĶuУ
+    /// ȻֻuڽӱߣͨDecreaseKeyuھӵkey\n
+    /// Prim㷨ȡȶʵֵģģQueueTypeָ
+    /// - IndexedPriorityQueue<double>ѣĬϣO(ElgV)
+    /// - IndexedFibonacciHeap<double>쳲ѣO(E+VlgV)
+    /// - IndexedPairingHeap<double>Զѡ
+    ///
+    /// @param	g				ͼGraphicsViaAdjacencyListGraphicsViaCompressedSparseRow
+    /// @param	start_index		㿪ʼС
+    /// @param	parent			㷨parent[i]ΪСжiĸ㣬ʹstart_indexɴĶΪ-1
+    /// @return			СȺ˳еĶ
+    template<typename QueueType = IndexedPriorityQueue<double>, typename GraphType>
+    vector<size_t> Prim( GraphType &g, size_t start_index, vector<int> &parent )
+    {
+        size_t const n = g.GetVertex().size();
+        vector<double>	key( n, numeric_limits<double>::max() );
+        vector<bool>	in_tree( n, false );
+        vector<size_t>	order;
+        parent.assign( n, -1 );
+
+        QueueType Q( n );
+        key[start_index] = 0;
+        Q.Push( start_index, 0 );
+
+        while ( !Q.IsEmpty() )
+        {
+            //õСⶥСĶ
+            size_t u = Q.Top();
+            Q.Pop();
+            in_tree[u] = true;
+            order.push_back( u );
+
+            for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+            {
+                size_t v = it->AimNodeIndex;
+                if ( !in_tree[v] && it->Weight < key[v] )
+                {
+                    key[v] = it->Weight;
+                    parent[v] = u;
+                    if ( Q.Contains( v ) )
+                    {
+                        Q.DecreaseKey( v, key[v] );
+                    }
+                    else
+                    {
+                        Q.Push( v, key[v] );
+                    }
+                }
+            }
+        }
+
+        return order;
+    }
+}
\ No newline at end of file
@@ -1,3 +1,4 @@
+#pragma once
 //////////////////////////////////////////////////////////////////////////
 /// @file		priority_queue.h
 /// @brief		ȶ
@@ -18,6 +19,7 @@
 #include <algorithm>
 #include <iterator>
 #include <queue>
+#include <functional>
 using namespace std;
 
 namespace ita
@@ -119,4 +121,155 @@ namespace ita
 		Comparator				_comparator;	///< Ƚ
 	};
 
+
+	/// @brief ȶУ֧DecreaseKey
+	///
+	/// PriorityQueueеԪһӾͲ޸ȼҪ޸ֻܵRefreshQueueؽѣO(n)\n
+	/// IndexedPriorityQueueеԪ[0, capacity)ΧڵıţÿŴһֵkeyڲ˶֮⻹ά
+	///  -> ڶеλáӳ䣬˿O(lgn)ʱ޸ĳŵkeyָѵʡ\n
+	/// DijkstraPrim㷨ҪȶУöӣDecreaseKeyؽѡ
+	/// @param	KeyType			ֵ
+	/// @param	Comparator		PriorityQueueĺͬĬϵgreater<KeyType>ʹkeyСıλڶףСѣ
+	/// @see	class PriorityQueue
+	template <
+		typename KeyType,
+		typename Comparator = greater<KeyType >>
+	class IndexedPriorityQueue
+	{
+	public:
+		/// һյȶУɱΪ[0, capacity)Ԫ
+		explicit IndexedPriorityQueue( size_t capacity ) : _position( capacity, _NotInQueue() ), _keys( capacity )
+		{
+			_heap.reserve( capacity );
+		}
+
+		/// ΪindexԪԼֵkeyӣҪindexڶ
+		void Push( size_t index, KeyType const &key )
+		{
+			_keys[index] = key;
+			_position[index] = _heap.size();
+			_heap.push_back( index );
+			_SiftUp( _heap.size() - 1 );
+		}
+
+		/// ȼߵĶԪصı
+		size_t Top() const
+		{
+			return _heap[0];
+		}
+
+		/// Ԫصļֵ
+		KeyType const & TopKey() const
+		{
+			return _keys[_heap[0]];
+		}
+
+		/// ׵Ԫس
+		void Pop()
+		{
+			_position[_heap[0]] = _NotInQueue();
+			_heap[0] = _heap.back();
+			_heap.pop_back();
+			if ( !_heap.empty() )
+			{
+				_position[_heap[0]] = 0;
+				_SiftDown( 0 );
+			}
+		}
+
+		/// @brief ߱ΪindexԪصȼ
+		///
+		/// ĬϵС˵ǰkeyСΪnew_keyҪnew_keyȼԭkey
+		void DecreaseKey( size_t index, KeyType const &new_key )
+		{
+			_keys[index] = new_key;
+			_SiftUp( _position[index] );
+		}
+
+		/// ΪindexԪǷڶ
+		bool Contains( size_t index ) const
+		{
+			return _position[index] != _NotInQueue();
+		}
+
+		/// ΪindexԪصļֵ
+		KeyType const & Key( size_t index ) const
+		{
+			return _keys[index];
+		}
+
+		/// ѯǷΪ
+		bool IsEmpty() const
+		{
+			return _heap.empty();
+		}
+
+		/// Ԫصĸ
+		size_t Size() const
+		{
+			return _heap.size();
+		}
+
+	private:
+		/// ʶڶеıŵλ
+		static size_t _NotInQueue()
+		{
+			return static_cast<size_t>( -1 );
+		}
+
+		/// λϵԪأͬʱάλӳ
+		void _Swap( size_t pos1, size_t pos2 )
+		{
+			std::swap( _heap[pos1], _heap[pos2] );
+			_position[_heap[pos1]] = pos1;
+			_position[_heap[pos2]] = pos2;
+		}
+
+		/// posλϵԪϵʵλ
+		void _SiftUp( size_t pos )
+		{
+			while ( pos > 0 )
+			{
+				size_t parent = ( pos - 1 ) / 2;
+				if ( !_comparator( _keys[_heap[parent]], _keys[_heap[pos]] ) )
+				{
+					break;
+				}
+				_Swap( parent, pos );
+				pos = parent;
+			}
+		}
+
+		/// posλϵԪµʵλãheap_sort.cppеMakeHeapֻͬдѭ
+		void _SiftDown( size_t pos )
+		{
+			for ( ;; )
+			{
+				size_t left = 2 * pos + 1;
+				size_t right = 2 * pos + 2;
+				size_t the_max = pos;
+
+				if ( left < _heap.size() && _comparator( _keys[_heap[the_max]], _keys[_heap[left]] ) )
+				{
+					the_max = left;
+				}
+				if ( right < _heap.size() && _comparator( _keys[_heap[the_max]], _keys[_heap[right]] ) )
+				{
+					the_max = right;
+				}
+				if ( the_max == pos )
+				{
+					break;
+				}
+				_Swap( pos, the_max );
+				pos = the_max;
+			}
+		}
+
+		vector<size_t>			_heap;			///< ѣŵԪصı
+		vector<size_t>			_position;		///< _position[index]Ϊindex_heapеλãڶʱΪ_NotInQueue()
+		vector<KeyType>			_keys;			///< _keys[index]Ϊindexļֵ
+		Comparator				_comparator;	///< Ƚ
+	};
+
 }
\ No newline at end of file
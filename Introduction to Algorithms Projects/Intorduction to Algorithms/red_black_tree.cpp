@@ -21,11 +21,79 @@
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <cstdint>
+#include <utility>
+#include <ctime>
+#include <thread>
+#include <chrono>
+#include <functional>
 #include "graphviz_shower.h"
+#include "node_pool.h"
 using namespace std;
 
 namespace ita
 {
+	/// @brief ţάκθϢ
+	///
+	/// ŲԹ涨ÿ㸽ӵϢDataԼɽԼļֵӵĸϢĸϢUpdate
+	/// Ϊnilʱnullptrڽ仯롢ɾת֮ԵϵصUpdate
+	/// ֻҪϢֻڽĺӣ14µĶ14.1άͲıɾO(lgn)ʱ䡣
+	struct RBTreeNoAugment
+	{
+		struct Data
+		{
+		};
+
+		template<typename TKey, typename TValue>
+		static void Update( Data &, TKey const &, TValue const &, Data const *, Data const * )
+		{
+
+		}
+	};
+
+	/// ţнĸ˳ͳ
+	struct RBTreeSizeAugment
+	{
+		struct Data
+		{
+			size_t		Size;		///< ԸýΪнĸ
+
+			Data() : Size( 0 ) {}
+		};
+
+		template<typename TKey, typename TValue>
+		static void Update( Data &data, TKey const &, TValue const &, Data const *left, Data const *right )
+		{
+			data.Size = 1 + ( left ? left->Size : 0 ) + ( right ? right->Size : 0 );
+		}
+	};
+
+	/// ţҶ˵ֵļΪ(low, high)
+	template<typename T>
+	struct RBTreeIntervalAugment
+	{
+		struct Data
+		{
+			T			Max;		///< ԸýΪҶ˵ֵ
+
+			Data() : Max() {}
+		};
+
+		template<typename TValue>
+		static void Update( Data &data, pair<T, T> const &key, TValue const &, Data const *left, Data const *right )
+		{
+			data.Max = key.second;
+			if ( left && data.Max < left->Max )
+			{
+				data.Max = left->Max;
+			}
+			if ( right && data.Max < right->Max )
+			{
+				data.Max = right->Max;
+			}
+		}
+	};
+
 	/// @brief 
 	///
 	/// 漸()ĶΪ
@@ -47,9 +115,18 @@ namespace ita
 	/// һͨĺҪûôϸ
 	/// - ֮ôЧΪ<span style="color:#FF0000 ">ƽ</span>ģֲҪȫƽ⣬ά
 	/// ĴۡڼѧдӣʹýƵĶЧʡѡ쳲ѵȵʤ
-	/// @param	TKey	м
-	/// @param	TValue	ֵ
-	template<typename TKey, typename TValue>
+	///
+	/// Ĵ洢
+	/// - ûиָ롣ɾӸһˣѾĽһջ·޸ʱҪĸ㡢游㶼·ȡã
+	/// - ɫָλУָٰ룬λ0һֻKeyValueָ룻
+	/// - ԼNodePoolгɿط䣬ɾĽ֮ĲãClearֻǰеĿ黹ϵͳҪͷţ
+	/// - ڱnilÿԼĳԱ֮ͬûκι״̬ڲͬ߳зֱʹá
+	///
+	/// лάĸϢݽṹţŲTAugmentĬϲάκϢҲռÿռ䡣
+	/// @param	TKey		м
+	/// @param	TValue		ֵ
+	/// @param	TAugment	ŲԣRBTreeNoAugment
+	template<typename TKey, typename TValue, typename TAugment = RBTreeNoAugment>
 	class RBTree
 	{
 	public:
@@ -60,41 +137,229 @@ namespace ita
 			RED				///< ɫ
 		};
 
-		/// еĽ
-		struct RBTreeNode
+		/// еĽ㣬ϢΪͨΪյģ
+		struct RBTreeNode : public TAugment::Data
 		{
 			TKey				Key;			///< еKEY
 			TValue				Value;			///< еֵ
-			RBTreeNodeColor		Color;			///< ɫɫǺɫ
-			RBTreeNode			*Parent;		///< ָ
-			RBTreeNode			*Left;			///< ָ
-			RBTreeNode			*Right;			///< Һָ
 
-			/// @brief ǷЧڱnil Ч㣩
-			/// @return			ýǷΪЧ㣬Ϊnil
-			/// @retval	true	nil
-			/// @retval false	nil
-			inline bool IsValid() const
+			RBTreeNode() : Key(), Value(), _left_and_color( 0 ), _right( nullptr )
+			{
+
+			}
+
+			/// ָ
+			RBTreeNode * Left() const
+			{
+				return reinterpret_cast<RBTreeNode *>( _left_and_color & ~static_cast<uintptr_t>( 1 ) );
+			}
+
+			/// Һָ
+			RBTreeNode * Right() const
+			{
+				return _right;
+			}
+
+			/// ɫɫǺɫ
+			RBTreeNodeColor Color() const
+			{
+				return static_cast<RBTreeNodeColor>( _left_and_color & 1 );
+			}
+
+			/// ԸýΪĸϢ
+			typename TAugment::Data const & Augmented() const
 			{
-				return ( this != s_nil );
+				return *this;
 			}
+
+		private:
+			friend class RBTree;
+
+			void SetLeft( RBTreeNode *left )
+			{
+				_left_and_color = reinterpret_cast<uintptr_t>( left ) | ( _left_and_color & 1 );
+			}
+
+			void SetRight( RBTreeNode *right )
+			{
+				_right = right;
+			}
+
+			void SetColor( RBTreeNodeColor color )
+			{
+				_left_and_color = ( _left_and_color & ~static_cast<uintptr_t>( 1 ) ) | static_cast<uintptr_t>( color );
+			}
+
+			uintptr_t			_left_and_color;	///< ָ룬λΪɫ
+			RBTreeNode			*_right;			///< Һָ
 		};
 
-		RBTree()
+	private:
+		/// @brief Ӹǰ·
+		///
+		/// ĸ߶Ȳ2lg(n + 1)128κܷŽڴ㹻ˡʱֻõĲ
+		struct _Path
 		{
-			if ( !s_nil )
+			RBTreeNode	*Nodes[130];
+			size_t		Depth;
+
+			_Path() : Depth( 0 ) {}
+
+			_Path( _Path const &other ) : Depth( other.Depth )
 			{
-				//Ҷӽһĺڽ
-				s_nil = new RBTreeNode();
-				s_nil->Color = BLACK;
+				copy( other.Nodes, other.Nodes + other.Depth, Nodes );
 			}
 
-			_root = s_nil;
-		}
+			_Path & operator=( _Path const &other )
+			{
+				Depth = other.Depth;
+				copy( other.Nodes, other.Nodes + other.Depth, Nodes );
+				return *this;
+			}
+
+			void Push( RBTreeNode *node )
+			{
+				Nodes[Depth++] = node;
+			}
+
+			RBTreeNode * Top() const
+			{
+				return Nodes[Depth - 1];
+			}
+		};
+
+	public:
+		/// @brief ˳˫
+		///
+		/// ûиָ룬ԼŴӸǰ·
+		/// - ʱߵĽ㣬;ѹ·
+		/// - ·ˣֱĳ˳Ạ̊́
+		/// ǰ֮Գơÿ౻ѹ롢һΣԱO(n)ģҪݹ顣
+		/// ·ΪձʾEnd()
+		/// @code
+		/// for ( auto it = tree.LowerBound( lo ); it != tree.End() && it.Key() < hi; ++it )
+		/// {
+		///     //it.Key(), it.Value()
+		/// }
+		/// @endcode
+		/// @note	ɾ֮֮ǰõĵʧЧ
+		class Iterator
+		{
+		public:
+			Iterator( RBTree const *tree = nullptr ) : _tree( tree )
+			{
+
+			}
+
+			TKey const & Key() const
+			{
+				return _path.Top()->Key;
+			}
+
+			TValue & Value() const
+			{
+				return _path.Top()->Value;
+			}
+
+			/// ǰ
+			RBTreeNode * Node() const
+			{
+				return _path.Top();
+			}
+
+			/// ƶһ㣻߹һEnd()
+			Iterator & operator++()
+			{
+				RBTreeNode *node = _path.Top();
+				if ( node->Right() != &_tree->_nil )
+				{
+					_path.Push( node->Right() );
+					_PushLeftmost();
+				}
+				else
+				{
+					_PopUntilFrom( &RBTreeNode::Left );
+				}
+				return *this;
+			}
+
+			/// ƶһ㣻End()ǰƶһһ
+			Iterator & operator--()
+			{
+				if ( _path.Depth == 0 )
+				{
+					_path.Push( _tree->_root );
+					_PushRightmost();
+				}
+				else if ( _path.Top()->Left() != &_tree->_nil )
+				{
+					_path.Push( _path.Top()->Left() );
+					_PushRightmost();
+				}
+				else
+				{
+					_PopUntilFrom( &RBTreeNode::Right );
+				}
+				return *this;
+			}
+
+			bool operator==( Iterator const &other ) const
+			{
+				return _path.Depth == other._path.Depth && ( _path.Depth == 0 || _path.Top() == other._path.Top() );
+			}
+
+			bool operator!=( Iterator const &other ) const
+			{
+				return !( *this == other );
+			}
+
+		private:
+			friend class RBTree;
+
+			/// ջһֱߵͷ
+			void _PushLeftmost()
+			{
+				while ( _path.Top()->Left() != &_tree->_nil )
+				{
+					_path.Push( _path.Top()->Left() );
+				}
+			}
+
+			/// ջһֱߵͷ
+			void _PushRightmost()
+			{
+				while ( _path.Top()->Right() != &_tree->_nil )
+				{
+					_path.Push( _path.Top()->Right() );
+				}
+			}
+
+			/// ·ˣֱӸside˳˵֮ʱ·Ϊ
+			void _PopUntilFrom( RBTreeNode * ( RBTreeNode::*side )() const )
+			{
+				RBTreeNode *child = _path.Top();
+				--_path.Depth;
+				while ( _path.Depth > 0 && ( _path.Top()->*side )() != child )
+				{
+					child = _path.Top();
+					--_path.Depth;
+				}
+			}
+
+			RBTree const	*_tree;		///< ڵ
+			_Path			_path;		///< Ӹǰ·
+		};
 
-		~RBTree()
+		/// @brief һÿյĺ
+		///
+		/// @param	first_slab_size		صһĽ֮ÿ鷭СӦȡСһЩ
+		explicit RBTree( size_t first_slab_size = 16 ) : _pool( first_slab_size ), _size( 0 )
 		{
-			_RecursiveReleaseNode( _root );
+			//Ҷӽһĺڽ
+			_nil.SetLeft( &_nil );
+			_nil.SetRight( &_nil );
+			_nil.SetColor( BLACK );
+			_root = &_nil;
 		}
 
 		/// @brief һ
@@ -109,24 +374,45 @@ namespace ita
 		/// - 4½㱻뵽ɫ֮ʱ
 		bool Insert( TKey key, TValue value )
 		{
-			if ( Search( key )->IsValid() )
+			_Path path;
+			RBTreeNode *node = _root;
+			while ( node != &_nil )
 			{
-				//keyظʧ
-				return false;
+				if ( !( key < node->Key ) && !( node->Key < key ) )
+				{
+					//keyظʧ
+					return false;
+				}
+				path.Push( node );
+				node = ( key < node->Key ? node->Left() : node->Right() );
+			}
+
+			//ӵĽΪ㣬Left=Right=nil
+			RBTreeNode *new_node = new ( _pool.Allocate() ) RBTreeNode();
+			new_node->Key = key;
+			new_node->Value = value;
+			new_node->SetLeft( &_nil );
+			new_node->SetRight( &_nil );
+			new_node->SetColor( RED );
+
+			if ( path.Depth == 0 )
+			{
+				_root = new_node;
+			}
+			else if ( key < path.Top()->Key )
+			{
+				path.Top()->SetLeft( new_node );
 			}
 			else
 			{
-				//ӵĽΪ㣬Left=Right=s_nil
-				RBTreeNode *new_node = new RBTreeNode();
-				new_node->Key = key;
-				new_node->Value = value;
-				new_node->Color = RED;
-				new_node->Left = new_node->Right = s_nil;
-
-				_InsertAsNormalBSTree( new_node );
-				_InsertFixup( new_node );
-				return true;
+				path.Top()->SetRight( new_node );
 			}
+			path.Push( new_node );
+			++_size;
+			_UpdatePath( path );
+
+			_InsertFixup( path );
+			return true;
 		}
 
 		/// @brief ɾһ
@@ -143,79 +429,216 @@ namespace ita
 		/// - 2yǸʱyһǺɫʱӳΪ㣻
 		/// - 4xp[y]Ǻɫʱ
 		/// - 5y·Уڸ߶ȶˣ
+		///
+		/// zʱĺyzλãͬzɫǸyļֵĵַı䡣
 		bool Delete( TKey key )
 		{
-			RBTreeNode *z = Search( key );
-			if ( z->IsValid() )
+			_Path path;
+			RBTreeNode *z = _root;
+			while ( z != &_nil && ( key < z->Key || z->Key < key ) )
+			{
+				path.Push( z );
+				z = ( key < z->Key ? z->Left() : z->Right() );
+			}
+			if ( z == &_nil )
+			{
+				//ҪɾĽ㲻
+				return false;
+			}
+
+			//xǶ汻ɾλõĽ㣬pathΪxȣremoved_colorΪʵʴʧǸɫ
+			RBTreeNode *x = nullptr;
+			RBTreeNode *z_parent = ( path.Depth > 0 ? path.Top() : &_nil );
+			RBTreeNodeColor removed_color = z->Color();
+			if ( z->Left() == &_nil || z->Right() == &_nil )
 			{
-				//ʵҪɾĽ㣬Ϊһʵɾy֮ʹﵽzЧ
-				RBTreeNode *y = nullptr;
-				if ( !z->Left->IsValid() || !z->Right->IsValid() )
+				//һΪnil
+				x = ( z->Left() != &_nil ? z->Left() : z->Right() );
+				_ReplaceChild( z_parent, z, x );
+			}
+			else
+			{
+				//ҺӾΪnilҺyһ£ͷ
+				size_t z_index = path.Depth;
+				path.Push( z );
+				RBTreeNode *y = z->Right();
+				while ( y->Left() != &_nil )
 				{
-					//һΪnil
-					y = z;
+					path.Push( y );
+					y = y->Left();
 				}
-				else
+
+				removed_color = y->Color();
+				x = y->Right();
+				if ( path.Top() != z )
 				{
-					//ҺӾΪnilҺ
-					y = _Successor( z );
+					//yzҺӣyȰԼλøҺӣٽӹz
+					path.Top()->SetLeft( x );
+					y->SetRight( z->Right() );
 				}
+				y->SetLeft( z->Left() );
+				y->SetColor( z->Color() );
+				_ReplaceChild( z_parent, z, y );
+				path.Nodes[z_index] = y;
+			}
+
+			_UpdatePath( path );
+			if ( removed_color == BLACK )
+			{
+				_DeleteFixup( x, path );
+			}
+
+			_pool.Release( z );
+			--_size;
+			return true;
+		}
+
+		/// ںһ㣬Ҳʱnullptr
+		RBTreeNode * Search( TKey const &key )
+		{
+			RBTreeNode *node = _root;
+			while ( node != &_nil && ( key < node->Key || node->Key < key ) )
+			{
+				node = ( key < node->Key ? node->Left() : node->Right() );
+			}
+			return node != &_nil ? node : nullptr;
+		}
+
+		/// ָСĽĵ
+		Iterator Begin() const
+		{
+			Iterator it( this );
+			if ( _root != &_nil )
+			{
+				it._path.Push( _root );
+				it._PushLeftmost();
+			}
+			return it;
+		}
+
+		/// ָһ֮ĵ
+		Iterator End() const
+		{
+			return Iterator( this );
+		}
 
-				RBTreeNode *x = ( y->Left->IsValid() ? y->Left : y->Right );
-				x->Parent = y->Parent;
+		/// ָΪkeyĽĵʱΪEnd()
+		Iterator Find( TKey const &key ) const
+		{
+			Iterator it = LowerBound( key );
+			return ( it != End() && !( key < it.Key() ) ) ? it : End();
+		}
 
-				if ( !y->Parent->IsValid() )
+		/// ָһСkeyĽĵʱΪEnd()
+		Iterator LowerBound( TKey const &key ) const
+		{
+			//·ضϵһСkeyߣĽ
+			Iterator it( this );
+			size_t depth = 0;
+			for ( RBTreeNode *node = _root; node != &_nil; )
+			{
+				it._path.Push( node );
+				if ( node->Key < key )
 				{
-					_root = x;
+					node = node->Right();
 				}
 				else
 				{
-					if ( y == y->Parent->Left )
-					{
-						y->Parent->Left = x;
-					}
-					else
-					{
-						y->Parent->Right = x;
-					}
+					depth = it._path.Depth;
+					node = node->Left();
 				}
+			}
+			it._path.Depth = depth;
+			return it;
+		}
 
-				if ( y != z )
+		/// ָһkeyĽĵʱΪEnd()
+		Iterator UpperBound( TKey const &key ) const
+		{
+			Iterator it( this );
+			size_t depth = 0;
+			for ( RBTreeNode *node = _root; node != &_nil; )
+			{
+				it._path.Push( node );
+				if ( key < node->Key )
 				{
-					z->Key = y->Key;
-					z->Value = y->Value;
+					depth = it._path.Depth;
+					node = node->Left();
 				}
-
-				if ( y->Color == BLACK )
+				else
 				{
-					_DeleteFixup( x );
+					node = node->Right();
 				}
-
-				delete y;	//ʵɾy
-				return true;
 			}
-			else
+			it._path.Depth = depth;
+			return it;
+		}
+
+		/// жϺǷΪ
+		bool Empty() const
+		{
+			return _root == &_nil;
+		}
+
+		/// ĸ
+		size_t Size() const
+		{
+			return _size;
+		}
+
+		/// ɾеĽ㣬һԵͷŽأҪ
+		void Clear()
+		{
+			_pool.Clear();
+			_root = &_nil;
+			_size = 0;
+		}
+
+		/// @brief otherен㲢뱾жеļеֵ
+		///
+		/// Joinķ㷨ȡotherĸ(L2, k, R2)kѱSplitΪ(L1, R1)ݹL1L2R1R2
+		/// kJoinݹ黥ɣǰָ̲ͬ߳еִС
+		/// m <= nֱΪĴСܵĹΪO(m lg(n / m + 1))O(m lgn)٣ҿԲС\n
+		/// other޸ģֻotherеļΪ½㡣
+		/// @param	thread_count	ͬʱʹõ̸߳
+		void Union( RBTree const &other, size_t thread_count = thread::hardware_concurrency() )
+		{
+			if ( &other == this )
 			{
-				//ҪɾĽ㲻
-				return false;
+				return;
 			}
+			_SetOperationContext context;
+			_Subtree result = _Union( _Whole(), other._root, other._BlackHeight( other._root ), other, context, _ParallelDepth( thread_count ) );
+			_FinishSetOperation( result, context );
 		}
 
-		/// ںһ
-		RBTreeNode * Search( TValue const &value )
+		/// @brief ֻмҲotherеĽ
+		///
+		/// UnionͬķΣkֿkڱʱJoinߵĽJoin2ֱߵĽ
+		void Intersection( RBTree const &other, size_t thread_count = thread::hardware_concurrency() )
 		{
-			RBTreeNode *node = _root;
-			while ( node != s_nil && node->Value != value )
+			if ( &other == this )
 			{
-				node = ( value < node->Value ? node->Left : node->Right );
+				return;
 			}
-			return node;
+			_SetOperationContext context;
+			_Subtree result = _Intersection( _Whole(), other._root, other._BlackHeight( other._root ), other, context, _ParallelDepth( thread_count ) );
+			_FinishSetOperation( result, context );
 		}
 
-		/// жϺǷΪ
-		bool Empty()
+		/// @brief ɾмҲotherеĽ
+		///
+		/// UnionͬķΣkֿ֮󶪵kJoin2ߵĽ
+		void Difference( RBTree const &other, size_t thread_count = thread::hardware_concurrency() )
 		{
-			return !( _root->IsValid() );
+			if ( &other == this )
+			{
+				Clear();
+				return;
+			}
+			_SetOperationContext context;
+			_Subtree result = _Difference( _Whole(), other._root, other._BlackHeight( other._root ), other, context, _ParallelDepth( thread_count ) );
+			_FinishSetOperation( result, context );
 		}
 
 		/// @brief ʾǰ״̬
@@ -231,276 +654,765 @@ namespace ita
 			qi::ShowGraphvizViaDot( ss.str() );
 		}
 
+	protected:
+		RBTreeNode				_nil;		///< Ҷӽ㣨ڱÿһ
+		RBTreeNode				*_root;		///< 
+
 	private:
-		void _RecursiveReleaseNode( RBTreeNode *node )
-		{
-			if ( node->IsValid() )
-			{
-				_RecursiveReleaseNode( node->Left );
-				_RecursiveReleaseNode( node->Right );
-				delete node;
-			}
-		}
+		RBTree( RBTree const & );
+		RBTree & operator=( RBTree const & );
 
-		void _Display( stringstream &ss, RBTreeNode *node ) const
+		void _Display( stringstream &ss, RBTreeNode const *node ) const
 		{
-			if ( node->IsValid() )
+			if ( node != &_nil )
 			{
-				ss << "    node" << node->Value << "[label = \"<f0>|<f1>" << node->Value << "|<f2>\", color = " << ( node->Color == RED ? "red" : "black" ) << "];" << endl;
+				ss << "    node" << node->Value << "[label = \"<f0>|<f1>" << node->Value << "|<f2>\", color = " << ( node->Color() == RED ? "red" : "black" ) << "];" << endl;
 
-				if ( node->Left->IsValid() )
+				if ( node->Left() != &_nil )
 				{
-					ss << "    \"node" << node->Value << "\":f0 -> \"node" << node->Left->Value << "\":f1;" << endl;
-					_Display( ss, node->Left );
+					ss << "    \"node" << node->Value << "\":f0 -> \"node" << node->Left()->Value << "\":f1;" << endl;
+					_Display( ss, node->Left() );
 				}
 
-				if ( node->Right->IsValid() )
+				if ( node->Right() != &_nil )
 				{
-					ss << "    \"node" << node->Value << "\":f2 -> \"node" << node->Right->Value << "\":f1;" << endl;
-					_Display( ss, node->Right );
+					ss << "    \"node" << node->Value << "\":f2 -> \"node" << node->Right()->Value << "\":f1;" << endl;
+					_Display( ss, node->Right() );
 				}
 			}
 		}
 
-		/// @brief һ򵥵ؼ
-		///
-		/// ӸúΪͨĶ򵥵ĽвҪڴ֮
-		/// @note		һҪ֤node->Keyһһµֵѭﲻ
-		void _InsertAsNormalBSTree( RBTreeNode *node )
+		/// parentָold_childĺָΪָnew_childparentΪnilʱold_childǸ
+		void _ReplaceChild( RBTreeNode *parent, RBTreeNode *old_child, RBTreeNode *new_child )
 		{
-			if ( !_root->IsValid() )
+			if ( parent == &_nil )
 			{
-				//ǵ1ڵ
-				_root = node;
-				_root->Left = _root->Right = _root->Parent = s_nil;
-				_root->Color = BLACK;
-				return;
+				_root = new_child;
+			}
+			else if ( parent->Left() == old_child )
+			{
+				parent->SetLeft( new_child );
 			}
+			else
+			{
+				parent->SetRight( new_child );
+			}
+		}
 
-			//ǵ1ڵ
-			RBTreeNode *current_node = _root;
+		/// ɺӵĸϢ¼ĸϢ
+		void _Update( RBTreeNode *node )
+		{
+			TAugment::Update( *node, node->Key, node->Value,
+				node->Left() != &_nil ? node->Left() : nullptr,
+				node->Right() != &_nil ? node->Right() : nullptr );
+		}
 
-			while ( true )
+		/// ·ϵĽ˱仯Եϵ¼ǵĸϢ
+		void _UpdatePath( _Path const &path )
+		{
+			for ( size_t i = path.Depth; i > 0; --i )
 			{
-				RBTreeNode *&next_node_pointer = ( node->Key > current_node->Key ? current_node->Right : current_node->Left );
-				if ( next_node_pointer->IsValid() )
-				{
-					current_node = next_node_pointer;
-				}
-				else
-				{
-					//Ĳ
-					node->Parent = current_node;
-					next_node_pointer = node;
-					break;
-				}
+				_Update( path.Nodes[i - 1] );
 			}
 		}
 
 		/// @brief Բ޸
 		///
 		/// ڶԺĲƻ˺ʣҪ
-		/// @note		nodeĽҪĽ㣬ƻ˺ʣһǺ
-		void _InsertFixup( RBTreeNode * node )
+		/// @note		pathջҪĽ㣬ƻ˺ʣһǺ
+		void _InsertFixup( _Path &path )
 		{
-			while ( node->Parent->Color == RED )
+			//nodeΪpath.Nodes[i]ĸ游Ϊpath.Nodes[i - 1]path.Nodes[i - 2]ΪɫʱһǸ
+			size_t i = path.Depth - 1;
+			while ( i >= 2 && path.Nodes[i - 1]->Color() == RED )
 			{
+				RBTreeNode *node = path.Nodes[i];
+				RBTreeNode *parent = path.Nodes[i - 1];
+				RBTreeNode *grand_parent = path.Nodes[i - 2];
 				//ʶnodeĸǷΪnode游
-				bool parent_is_left_child_flag = ( node->Parent == node->Parent->Parent->Left );
+				bool parent_is_left_child_flag = ( parent == grand_parent->Left() );
 				//
-				RBTreeNode *uncle = parent_is_left_child_flag ? node->Parent->Parent->Right : node->Parent->Parent->Left;
-				if ( uncle->Color == RED )
+				RBTreeNode *uncle = parent_is_left_child_flag ? grand_parent->Right() : grand_parent->Left();
+				if ( uncle->Color() == RED )
 				{
 					//case1
-					node->Parent->Color = BLACK;
-					uncle->Color = BLACK;
-					node->Parent->Parent->Color = RED;
-					node = node->Parent->Parent;
+					parent->SetColor( BLACK );
+					uncle->SetColor( BLACK );
+					grand_parent->SetColor( RED );
+					i -= 2;
 				}
 				else
 				{
-					if ( node == ( parent_is_left_child_flag ? node->Parent->Right : node->Parent->Left ) )
+					if ( node == ( parent_is_left_child_flag ? parent->Right() : parent->Left() ) )
 					{
-						//case2
-						node = node->Parent;
-						parent_is_left_child_flag ? _LeftRotate( node ) : _RightRotate( node );
+						//case2ת֮nodeparentλ
+						parent_is_left_child_flag ? _LeftRotate( parent, grand_parent ) : _RightRotate( parent, grand_parent );
+						parent = node;
 					}
 
 					//case3
-					node->Parent->Color = BLACK;
-					node->Parent->Parent->Color = RED;
-					parent_is_left_child_flag ? _RightRotate( node->Parent->Parent ) : _LeftRotate( node->Parent->Parent );
+					parent->SetColor( BLACK );
+					grand_parent->SetColor( RED );
+					RBTreeNode *great_grand_parent = ( i >= 3 ? path.Nodes[i - 3] : &_nil );
+					parent_is_left_child_flag ? _RightRotate( grand_parent, great_grand_parent ) : _LeftRotate( grand_parent, great_grand_parent );
+					break;
 				}
 			}
 
 			//2ƻֻҪ򵥵һ仰
-			_root->Color = BLACK;
+			_root->SetColor( BLACK );
 		}
 
 		/// 
 		///
-		/// תһֶܱʵĲֲ
-		void _LeftRotate( RBTreeNode * node )
+		/// תһֶܱʵĲֲûиָ룬ɵ߸nodeĸparentnodeΪʱΪnil
+		void _LeftRotate( RBTreeNode *node, RBTreeNode *parent )
 		{
-			if ( !( node->IsValid() && node->Right->IsValid() ) )
+			if ( node == &_nil || node->Right() == &_nil )
 			{
 				//ҪԷڱвҪҺҲڱ
 				throw std::exception( "ҪԷڱвҪҺҲڱ" );
 			}
-			else
-			{
-				//nodeҺ
-				RBTreeNode *right_son = node->Right;
 
-				node->Right = right_son->Left;
-				if ( right_son->Left->IsValid() )
-				{
-					right_son->Left->Parent = node;
-				}
-				right_son->Parent = node->Parent;
-				if ( !( node->Parent->IsValid() ) )
-				{
-					_root = right_son;
-				}
-				else
-				{
-					if ( node == node->Parent->Left )
-					{
-						node->Parent->Left = right_son;
-					}
-					else
-					{
-						node->Parent->Right = right_son;
-					}
-				}
-				right_son->Left = node;
-				node->Parent = right_son;
-			}
+			_ReplaceChild( parent, node, _RotateLeft( node ) );
 		}
 
 		/// 
 		///
-		/// תһֶܱʵĲֲ
-		void _RightRotate( RBTreeNode * node )
+		/// תһֶܱʵĲֲûиָ룬ɵ߸nodeĸparentnodeΪʱΪnil
+		void _RightRotate( RBTreeNode *node, RBTreeNode *parent )
 		{
-			if ( !( node->IsValid() && node->Left->IsValid() ) )
+			if ( node == &_nil || node->Left() == &_nil )
 			{
 				//ҪԷڱвҪҲڱ
 				throw std::exception( "ҪԷڱвҪҲڱ" );
 			}
-			else
-			{
-				//node
-				RBTreeNode *left_son = node->Left;
 
-				node->Left = left_son->Right;
-				if ( left_son->Right->IsValid() )
-				{
-					left_son->Right->Parent = node;
-				}
-				left_son->Parent = node->Parent;
-				if ( !( node->Parent->IsValid() ) )
-				{
-					_root = left_son;
-				}
-				else
-				{
-					if ( node == node->Parent->Left )
-					{
-						node->Parent->Left = left_son;
-					}
-					else
-					{
-						node->Parent->Right = left_son;
-					}
-				}
-				left_son->Right = node;
-				node->Parent = left_son;
-			}
+			_ReplaceChild( parent, node, _RotateRight( node ) );
 		}
 
-		/// ɾ޸
-		void _DeleteFixup( RBTreeNode *x )
+		/// @brief ɾ޸
+		///
+		/// xһضĺɫpathΪxȣջΪxĸ㣩xnilxĸֻܴpathȡ
+		void _DeleteFixup( RBTreeNode *x, _Path &path )
 		{
-			while( x != _root && x->Color == BLACK )
+			while( x != _root && x->Color() == BLACK )
 			{
-				bool node_is_parent_left_child = ( x == x->Parent->Left );
-				RBTreeNode *w = node_is_parent_left_child ? x->Parent->Right : x->Parent->Left;
+				RBTreeNode *parent = path.Top();
+				RBTreeNode *grand_parent = ( path.Depth >= 2 ? path.Nodes[path.Depth - 2] : &_nil );
+				//xжĺɫֵwһnilxnilȽϲ
+				bool node_is_parent_left_child = ( x == parent->Left() );
+				RBTreeNode *w = node_is_parent_left_child ? parent->Right() : parent->Left();
 
-				if( w->Color == RED )
+				if( w->Color() == RED )
 				{
-					//case1
-					w->Color = BLACK;
-					x->Parent->Color = RED;
-					_LeftRotate( x->Parent );
-					w = x->Parent->Right;
+					//case1wתparent棬Ϊxµ游
+					w->SetColor( BLACK );
+					parent->SetColor( RED );
+					node_is_parent_left_child ? _LeftRotate( parent, grand_parent ) : _RightRotate( parent, grand_parent );
+					path.Nodes[path.Depth - 1] = w;
+					path.Push( parent );
+					grand_parent = w;
+					w = node_is_parent_left_child ? parent->Right() : parent->Left();
 				}
 
 				//case2
-				if( w->Left->Color == BLACK && w->Right->Color == BLACK )
+				if( w->Left()->Color() == BLACK && w->Right()->Color() == BLACK )
 				{
 					//ӶΪڽ
-					w->Color = RED;
-					x = x->Parent;
+					w->SetColor( RED );
+					x = parent;
+					--path.Depth;
 				}
 				else
 				{
 					//case3
-					if( ( node_is_parent_left_child ? w->Right->Color : w->Left->Color ) == BLACK )
+					if( ( node_is_parent_left_child ? w->Right() : w->Left() )->Color() == BLACK )
 					{
-						( node_is_parent_left_child ? w->Left->Color : w->Right->Color ) = BLACK;
-						w->Color = RED;
-						node_is_parent_left_child ? _RightRotate( w ) : _LeftRotate( w );
-						w = ( node_is_parent_left_child ? x->Parent->Right : x->Parent->Left );
+						( node_is_parent_left_child ? w->Left() : w->Right() )->SetColor( BLACK );
+						w->SetColor( RED );
+						node_is_parent_left_child ? _RightRotate( w, parent ) : _LeftRotate( w, parent );
+						w = ( node_is_parent_left_child ? parent->Right() : parent->Left() );
 					}
 
 					//case4
-					w->Color = x->Parent->Color;
-					x->Parent->Color = BLACK;
-					( node_is_parent_left_child ? w->Right->Color : w->Left->Color ) = BLACK;
-					node_is_parent_left_child ? _LeftRotate( x->Parent ) : _RightRotate( x->Parent );
+					w->SetColor( parent->Color() );
+					parent->SetColor( BLACK );
+					( node_is_parent_left_child ? w->Right() : w->Left() )->SetColor( BLACK );
+					node_is_parent_left_child ? _LeftRotate( parent, grand_parent ) : _RightRotate( parent, grand_parent );
 					x = _root;
 				}
 			}
 
 			//ֻҪxΪڽͿԣ_rootĸıѾԶ
-			x->Color = BLACK;    //Ϊɫ
+			x->SetColor( BLACK );    //Ϊɫ
 		}
 
-		/// õڵĺ
-		RBTreeNode * _Successor( RBTreeNode *node )
+		/// @brief һΪĺ
+		///
+		/// BlackHeightΪRootnilһ·ϺڽĸRootΪɫʱRootnilΪ0
+		/// JoinҪȽĺڸ߶ȣ;Ѻڸ߶һ𴫵ȥͲҪÿζ¼
+		struct _Subtree
 		{
-			if ( node->Right->IsValid() )
+			RBTreeNode	*Root;
+			size_t		BlackHeight;
+
+			_Subtree( RBTreeNode *root = nullptr, size_t black_height = 0 ) : Root( root ), BlackHeight( black_height ) {}
+		};
+
+		/// @brief һ˽״̬
+		///
+		/// ͬͬʱִʱܹñĽأ·ĽԼĽУĽȼ
+		/// ȵϲһ֮ͳһؽĽ
+		struct _SetOperationContext
+		{
+			NodePool<RBTreeNode>	Pool;		///< ·Ľ
+			vector<RBTreeNode *>	Garbage;	///< ȥĽ
+			size_t					Added;		///< ·Ľ
+
+			_SetOperationContext() : Added( 0 ) {}
+
+			void Merge( _SetOperationContext &child )
 			{
-				//ҽʱһ£ͷ
-				node = node->Right;
-				while ( node->Left->IsValid() )
-				{
-					node = node->Left;
-				}
-				return node;
+				Pool.Splice( child.Pool );
+				Garbage.insert( Garbage.end(), child.Garbage.begin(), child.Garbage.end() );
+				Added += child.Added;
+			}
+		};
+
+		/// ʹthread_count߳ʱݹǰ㲢еִ
+		static size_t _ParallelDepth( size_t thread_count )
+		{
+			size_t depth = 0;
+			while ( ( static_cast<size_t>( 1 ) << depth ) < thread_count )
+			{
+				++depth;
+			}
+			return depth;
+		}
+
+		/// otherкڸ߶ȲСֵ2^8 - 1㣩ֵýһ߳
+		static size_t _ParallelMinBlackHeight()
+		{
+			return 8;
+		}
+
+		/// @brief ֱִleft( context )right( context )
+		///
+		/// parallelΪtrueʱleftһµ̣߳ʹԼ״̬ϲcontext
+		template<typename Left, typename Right>
+		static void _Fork( bool parallel, _SetOperationContext &context, Left left, Right right )
+		{
+			if ( !parallel )
+			{
+				left( context );
+				right( context );
+				return;
+			}
+
+			_SetOperationContext child;
+			thread worker( [&]()
+			{
+				left( child );
+			} );
+			right( context );
+			worker.join();
+			context.Merge( child );
+		}
+
+		_Subtree _Whole()
+		{
+			return _Subtree( _root, _BlackHeight( _root ) );
+		}
+
+		/// ĽΪ·ĽͶĽ㶼Ľ
+		void _FinishSetOperation( _Subtree const &result, _SetOperationContext &context )
+		{
+			_root = result.Root;
+			_pool.Splice( context.Pool );
+			for ( size_t i = 0; i < context.Garbage.size(); ++i )
+			{
+				_pool.Release( context.Garbage[i] );
+			}
+			_size = _size + context.Added - context.Garbage.size();
+		}
+
+		/// ߵ·nodeĺڸ߶
+		size_t _BlackHeight( RBTreeNode const *node ) const
+		{
+			size_t height = 0;
+			for ( ; node != &_nil; node = node->Left() )
+			{
+				height += ( node->Color() == BLACK );
+			}
+			return height;
+		}
+
+		/// ĸΪɫʱΪɫڸ߶ȼ1ȻһúϷĺ
+		static void _BlackenRoot( _Subtree &tree )
+		{
+			if ( tree.Root->Color() == RED )
+			{
+				tree.Root->SetColor( BLACK );
+				++tree.BlackHeight;
+			}
+		}
+
+		/// nodeΪµĸ
+		RBTreeNode * _RotateLeft( RBTreeNode *node )
+		{
+			RBTreeNode *right_son = node->Right();
+			node->SetRight( right_son->Left() );
+			right_son->SetLeft( node );
+			_Update( node );
+			_Update( right_son );
+			return right_son;
+		}
+
+		/// nodeΪµĸ
+		RBTreeNode * _RotateRight( RBTreeNode *node )
+		{
+			RBTreeNode *left_son = node->Left();
+			node->SetLeft( left_son->Right() );
+			left_son->SetRight( node );
+			_Update( node );
+			_Update( left_son );
+			return left_son;
+		}
+
+		/// @brief Ϊһúleftеļ < middle->Key < rightеļ
+		///
+		/// ĸȶΪɫڸ߶ͬʱmiddleΪµĸŽϸߵǿң󣩱߽£
+		/// ҵڸ߶ϰͬĺڽcѺɫmiddle( c, ϰ )cλϣ
+		/// ޸;ĺ㡣ʱΪO(ڸ߶֮ + 1)صĸǺɫ
+		_Subtree _Join( _Subtree left, RBTreeNode *middle, _Subtree right )
+		{
+			_BlackenRoot( left );
+			_BlackenRoot( right );
+
+			_Subtree result;
+			if ( left.BlackHeight > right.BlackHeight )
+			{
+				result = _Subtree( _JoinRight( left.Root, left.BlackHeight, middle, right ), left.BlackHeight );
+			}
+			else if ( left.BlackHeight < right.BlackHeight )
+			{
+				result = _Subtree( _JoinLeft( left, middle, right.Root, right.BlackHeight ), right.BlackHeight );
 			}
 			else
 			{
-				//ҽʱһֱϣֱҵһηҺӻ򵽸Ϊֹ
-				RBTreeNode *y = node->Parent;
-				while ( !y->IsValid() && node == y->Right )
+				middle->SetLeft( left.Root );
+				middle->SetRight( right.Root );
+				middle->SetColor( RED );
+				_Update( middle );
+				result = _Subtree( middle, left.BlackHeight );
+			}
+			_BlackenRoot( result );
+			return result;
+		}
+
+		/// źڸ߶Ϊheightnodeұ߽£middlerightȥµnode
+		RBTreeNode * _JoinRight( RBTreeNode *node, size_t height, RBTreeNode *middle, _Subtree const &right )
+		{
+			if ( node->Color() == BLACK && height == right.BlackHeight )
+			{
+				middle->SetLeft( node );
+				middle->SetRight( right.Root );
+				middle->SetColor( RED );
+				_Update( middle );
+				return middle;
+			}
+
+			RBTreeNode *child = _JoinRight( node->Right(), height - ( node->Color() == BLACK ), middle, right );
+			node->SetRight( child );
+			if ( node->Color() == BLACK && child->Color() == RED && child->Right()->Color() == RED )
+			{
+				//޸case3ͬһתĺ
+				child->Right()->SetColor( BLACK );
+				return _RotateLeft( node );
+			}
+			_Update( node );
+			return node;
+		}
+
+		/// źڸ߶Ϊheightnode߽£leftmiddleȥµnode
+		RBTreeNode * _JoinLeft( _Subtree const &left, RBTreeNode *middle, RBTreeNode *node, size_t height )
+		{
+			if ( node->Color() == BLACK && height == left.BlackHeight )
+			{
+				middle->SetLeft( left.Root );
+				middle->SetRight( node );
+				middle->SetColor( RED );
+				_Update( middle );
+				return middle;
+			}
+
+			RBTreeNode *child = _JoinLeft( left, middle, node->Left(), height - ( node->Color() == BLACK ) );
+			node->SetLeft( child );
+			if ( node->Color() == BLACK && child->Color() == RED && child->Left()->Color() == RED )
+			{
+				child->Left()->SetColor( BLACK );
+				return _RotateRight( node );
+			}
+			_Update( node );
+			return node;
+		}
+
+		/// ûмӣȡleftĽΪм
+		_Subtree _Join2( _Subtree const &left, _Subtree const &right )
+		{
+			if ( left.Root == &_nil )
+			{
+				return right;
+			}
+			if ( right.Root == &_nil )
+			{
+				return left;
+			}
+
+			_Subtree rest;
+			RBTreeNode *last;
+			_SplitLast( left, rest, last );
+			return _Join( rest, last, right );
+		}
+
+		/// ѷǿյtreeΪĽlastĽrest
+		void _SplitLast( _Subtree const &tree, _Subtree &rest, RBTreeNode *&last )
+		{
+			RBTreeNode *node = tree.Root;
+			size_t child_height = tree.BlackHeight - ( node->Color() == BLACK );
+			if ( node->Right() == &_nil )
+			{
+				rest = _Subtree( node->Left(), child_height );
+				last = node;
+				return;
+			}
+
+			_Subtree right_rest;
+			_SplitLast( _Subtree( node->Right(), child_height ), right_rest, last );
+			rest = _Join( _Subtree( node->Left(), child_height ), node, right_rest );
+		}
+
+		/// @brief keytreeΪСkeyleftkeyrightkeyĽ㣨ûʱΪnullptrmiddle
+		///
+		/// Ӹߵkeyλã·ϰѾĽһߵJoinleftrightϡ
+		/// ÿһJoinĺڸ߶֮ߣܵʱΪO(lgn)
+		void _Split( _Subtree const &tree, TKey const &key, _Subtree &left, RBTreeNode *&middle, _Subtree &right )
+		{
+			RBTreeNode *node = tree.Root;
+			if ( node == &_nil )
+			{
+				left = right = _Subtree( &_nil, 0 );
+				middle = nullptr;
+				return;
+			}
+
+			size_t child_height = tree.BlackHeight - ( node->Color() == BLACK );
+			_Subtree node_left( node->Left(), child_height ), node_right( node->Right(), child_height );
+			if ( key < node->Key )
+			{
+				_Split( node_left, key, left, middle, right );
+				right = _Join( right, node, node_right );
+			}
+			else if ( node->Key < key )
+			{
+				_Split( node_right, key, left, middle, right );
+				left = _Join( node_left, node, left );
+			}
+			else
+			{
+				left = node_left;
+				middle = node;
+				right = node_right;
+			}
+		}
+
+		/// othernodeΪΪĽ
+		RBTreeNode * _Copy( RBTreeNode const *node, RBTree const &other, _SetOperationContext &context )
+		{
+			if ( node == &other._nil )
+			{
+				return &_nil;
+			}
+
+			RBTreeNode *copy = new ( context.Pool.Allocate() ) RBTreeNode();
+			copy->Key = node->Key;
+			copy->Value = node->Value;
+			copy->SetLeft( _Copy( node->Left(), other, context ) );
+			copy->SetRight( _Copy( node->Right(), other, context ) );
+			copy->SetColor( node->Color() );
+			_Update( copy );
+			++context.Added;
+			return copy;
+		}
+
+		/// nodeΪеĽΪҪĽ
+		void _Discard( RBTreeNode *node, _SetOperationContext &context )
+		{
+			if ( node != &_nil )
+			{
+				_Discard( node->Left(), context );
+				_Discard( node->Right(), context );
+				context.Garbage.push_back( node );
+			}
+		}
+
+		/// treeothernodeΪڸ߶ΪheightĲ
+		_Subtree _Union( _Subtree const &tree, RBTreeNode const *node, size_t height, RBTree const &other, _SetOperationContext &context, size_t parallel_depth )
+		{
+			if ( node == &other._nil )
+			{
+				return tree;
+			}
+			if ( tree.Root == &_nil )
+			{
+				return _Subtree( _Copy( node, other, context ), height );
+			}
+
+			_Subtree left, right, left_result, right_result;
+			RBTreeNode *middle;
+			_Split( tree, node->Key, left, middle, right );
+
+			size_t child_height = height - ( node->Color() == BLACK );
+			size_t child_depth = ( parallel_depth > 0 ? parallel_depth - 1 : 0 );
+			_Fork( parallel_depth > 0 && height >= _ParallelMinBlackHeight(), context, [&]( _SetOperationContext &task )
+			{
+				left_result = _Union( left, node->Left(), child_height, other, task, child_depth );
+			}, [&]( _SetOperationContext &task )
+			{
+				right_result = _Union( right, node->Right(), child_height, other, task, child_depth );
+			} );
+
+			if ( !middle )
+			{
+				//ֻotherеļ
+				middle = new ( context.Pool.Allocate() ) RBTreeNode();
+				middle->Key = node->Key;
+				middle->Value = node->Value;
+				++context.Added;
+			}
+			return _Join( left_result, middle, right_result );
+		}
+
+		/// treeothernodeΪڸ߶ΪheightĽ
+		_Subtree _Intersection( _Subtree const &tree, RBTreeNode const *node, size_t height, RBTree const &other, _SetOperationContext &context, size_t parallel_depth )
+		{
+			if ( tree.Root == &_nil )
+			{
+				return tree;
+			}
+			if ( node == &other._nil )
+			{
+				_Discard( tree.Root, context );
+				return _Subtree( &_nil, 0 );
+			}
+
+			_Subtree left, right, left_result, right_result;
+			RBTreeNode *middle;
+			_Split( tree, node->Key, left, middle, right );
+
+			size_t child_height = height - ( node->Color() == BLACK );
+			size_t child_depth = ( parallel_depth > 0 ? parallel_depth - 1 : 0 );
+			_Fork( parallel_depth > 0 && height >= _ParallelMinBlackHeight(), context, [&]( _SetOperationContext &task )
+			{
+				left_result = _Intersection( left, node->Left(), child_height, other, task, child_depth );
+			}, [&]( _SetOperationContext &task )
+			{
+				right_result = _Intersection( right, node->Right(), child_height, other, task, child_depth );
+			} );
+
+			return middle ? _Join( left_result, middle, right_result ) : _Join2( left_result, right_result );
+		}
+
+		/// treeothernodeΪڸ߶ΪheightĲ
+		_Subtree _Difference( _Subtree const &tree, RBTreeNode const *node, size_t height, RBTree const &other, _SetOperationContext &context, size_t parallel_depth )
+		{
+			if ( tree.Root == &_nil || node == &other._nil )
+			{
+				return tree;
+			}
+
+			_Subtree left, right, left_result, right_result;
+			RBTreeNode *middle;
+			_Split( tree, node->Key, left, middle, right );
+
+			size_t child_height = height - ( node->Color() == BLACK );
+			size_t child_depth = ( parallel_depth > 0 ? parallel_depth - 1 : 0 );
+			_Fork( parallel_depth > 0 && height >= _ParallelMinBlackHeight(), context, [&]( _SetOperationContext &task )
+			{
+				left_result = _Difference( left, node->Left(), child_height, other, task, child_depth );
+			}, [&]( _SetOperationContext &task )
+			{
+				right_result = _Difference( right, node->Right(), child_height, other, task, child_depth );
+			} );
+
+			if ( middle )
+			{
+				context.Garbage.push_back( middle );
+			}
+			return _Join2( left_result, right_result );
+		}
+
+
+		NodePool<RBTreeNode>	_pool;		///< 
+		size_t					_size;		///< ĸ
+	};
+
+
+	/// @brief ˳ͳ
+	///
+	/// ÿ㸽ΪĽǿO(lgn)ʱڣ
+	/// - SelectҳkСĽ㣻
+	/// - Rankһеļŵڼ
+	///
+	/// ٷλʱҪеݸƳSelect( p * Size() )ǵpλ
+	/// @note	ȴ0ʼСļΪ0Select( Rank( key ) )keyڵĽ
+	template<typename TKey, typename TValue>
+	class OrderStatisticTree : public RBTree<TKey, TValue, RBTreeSizeAugment>
+	{
+	public:
+		typedef typename RBTree<TKey, TValue, RBTreeSizeAugment>::RBTreeNode RBTreeNode;
+
+		explicit OrderStatisticTree( size_t first_slab_size = 16 ) : RBTree<TKey, TValue, RBTreeSizeAugment>( first_slab_size )
+		{
+
+		}
+
+		/// kСĽ㣨k0ʼk >= Size()ʱnullptr
+		RBTreeNode * Select( size_t k ) const
+		{
+			RBTreeNode *node = this->_root;
+			while ( node != &this->_nil )
+			{
+				size_t left_size = _SizeOf( node->Left() );
+				if ( k < left_size )
+				{
+					node = node->Left();
+				}
+				else if ( k == left_size )
+				{
+					return node;
+				}
+				else
 				{
-					node = y;
-					y = y->Parent;
+					k -= left_size + 1;
+					node = node->Right();
 				}
-				return y;
 			}
+			return nullptr;
 		}
 
+		/// Сkeyļĸkeyʱ
+		size_t Rank( TKey const &key ) const
+		{
+			size_t rank = 0;
+			RBTreeNode *node = this->_root;
+			while ( node != &this->_nil )
+			{
+				if ( node->Key < key )
+				{
+					//㶼Сkey
+					rank += _SizeOf( node->Left() ) + 1;
+					node = node->Right();
+				}
+				else
+				{
+					node = node->Left();
+				}
+			}
+			return rank;
+		}
 
-		RBTreeNode *_root;				///< 
-		static RBTreeNode *s_nil;		///< Ҷӽ㣨ڱ
+	private:
+		size_t _SizeOf( RBTreeNode const *node ) const
+		{
+			return node != &this->_nil ? node->Augmented().Size : 0;
+		}
 	};
 
+	/// @brief 
+	///
+	/// ļΪ[low, high]lowٰhigh򣩣ÿ㸽Ҷ˵ֵMax
+	/// - Overlaps( lo, hi )O(lgn)ҳһ[lo, hi]ص䡣ӸߣMaxСloʱ
+	///   ûص䣬ôҲһûУֻҪһߣ
+	/// - Overlaps( lo, hi, callback )ҳ[lo, hi]ص䣬Max < loԼlow > hi
+	///   ʱΪO(min(n, k lgn))kΪصĸ
+	/// @note	ȫֻͬܲһ
+	template<typename T, typename TValue>
+	class IntervalTree : public RBTree<pair<T, T>, TValue, RBTreeIntervalAugment<T>>
+	{
+	public:
+		typedef RBTree<pair<T, T>, TValue, RBTreeIntervalAugment<T>> BaseTree;
+		typedef typename BaseTree::RBTreeNode RBTreeNode;
+
+		explicit IntervalTree( size_t first_slab_size = 16 ) : BaseTree( first_slab_size )
+		{
 
-	template<typename TKey, typename TValue>
-	typename RBTree<TKey, TValue>::RBTreeNode * RBTree<TKey, TValue>::s_nil = nullptr;
+		}
+
+		/// [low, high]Ѿʱfalse
+		bool Insert( T const &low, T const &high, TValue const &value )
+		{
+			return BaseTree::Insert( make_pair( low, high ), value );
+		}
+
+		/// ɾ[low, high]
+		bool Delete( T const &low, T const &high )
+		{
+			return BaseTree::Delete( make_pair( low, high ) );
+		}
+
+		/// һ[lo, hi]صڵĽ㣬ʱnullptr
+		RBTreeNode * Overlaps( T const &lo, T const &hi ) const
+		{
+			RBTreeNode *node = this->_root;
+			while ( node != &this->_nil && !_Overlap( node, lo, hi ) )
+			{
+				bool go_left = node->Left() != &this->_nil && !( node->Left()->Augmented().Max < lo );
+				node = ( go_left ? node->Left() : node->Right() );
+			}
+			return node != &this->_nil ? node : nullptr;
+		}
+
+		/// @brief lowС˳򣬶ÿһ[lo, hi]صڵĽһcallback( node )
+		///
+		/// @return	صĸ
+		template<typename Callback>
+		size_t Overlaps( T const &lo, T const &hi, Callback callback ) const
+		{
+			return _Overlaps( this->_root, lo, hi, callback );
+		}
+
+	private:
+		static bool _Overlap( RBTreeNode const *node, T const &lo, T const &hi )
+		{
+			return !( hi < node->Key.first ) && !( node->Key.second < lo );
+		}
+
+		/// ݹȲ
+		template<typename Callback>
+		size_t _Overlaps( RBTreeNode *node, T const &lo, T const &hi, Callback &callback ) const
+		{
+			if ( node == &this->_nil || node->Augmented().Max < lo )
+			{
+				//Ҷ˵㶼lo
+				return 0;
+			}
+
+			size_t count = _Overlaps( node->Left(), lo, hi, callback );
+			if ( hi < node->Key.first )
+			{
+				//Լ˵㶼hiұ
+				return count;
+			}
+			if ( !( node->Key.second < lo ) )
+			{
+				callback( node );
+				++count;
+			}
+			return count + _Overlaps( node->Right(), lo, hi, callback );
+		}
+	};
 
 	/// 
 	int testRedBlackTree()
@@ -572,6 +1484,157 @@ namespace ita
 		}
 		bst.Display();
 
+		//õ˳ʣҪݹ
+		cout << "";
+		for ( auto it = bst.Begin(); it != bst.End(); ++it )
+		{
+			cout << it.Key() << " ";
+		}
+		cout << endl << "";
+		for ( auto it = bst.End(); it != bst.Begin(); )
+		{
+			--it;
+			cout << it.Key() << " ";
+		}
+		cout << endl << "[30, 60]еĽ㣺";
+		for ( auto it = bst.LowerBound( 30 ); it != bst.UpperBound( 60 ); ++it )
+		{
+			cout << it.Key() << " ";
+		}
+		cout << endl << "42" << ( bst.Find( 42 ) != bst.End() ? "ҵ" : "δҵ" ) << endl;
+
+		//ģÿһС10ø32ĺ㶼ÿԼĽз
+		clock_t start = clock();
+		size_t total = 0;
+		for ( int request = 0; request < 100000; ++request )
+		{
+			RBTree<int, int> small_map;
+			for ( int i = 0; i < 32; ++i )
+			{
+				small_map.Insert( ( i * 37 + request ) % 101, i );
+			}
+			total += small_map.Size();
+		}
+		cout << "10С" << total << "㣩ʱ" << ( clock() - start ) * 1000.0 / CLOCKS_PER_SEC << "ms" << endl;
+
 		return 0;
 	}
+	/// ˳ͳӦʱٷλ
+	void testOrderStatisticTree()
+	{
+		OrderStatisticTree<int, int> tree;
+		for ( int i = 0; i < 10000; ++i )
+		{
+			//Ӧʱ䣨΢룩ͬһʱֻ¼һ
+			tree.Insert( rand() % 100000, i );
+		}
+
+		double const percents[] = { 0.5, 0.9, 0.99 };
+		for ( size_t i = 0; i < sizeof( percents ) / sizeof( percents[0] ); ++i )
+		{
+			size_t k = static_cast<size_t>( percents[i] * ( tree.Size() - 1 ) );
+			cout << "" << percents[i] * 100 << "ٷλ" << tree.Select( k )->Key << endl;
+		}
+
+		int keys[] = { 0, 25000, 50000, 99999 };
+		for ( size_t i = 0; i < sizeof( keys ) / sizeof( keys[0] ); ++i )
+		{
+			cout << "С" << keys[i] << "Ԫ" << tree.Rank( keys[i] ) << "" << endl;
+		}
+
+		//ɾһ֮ٲѯ
+		for ( int key = 0; key < 100000; key += 2 )
+		{
+			tree.Delete( key );
+		}
+		cout << "ɾеż֮ʣ" << tree.Size() << "Ԫأλ" << tree.Select( tree.Size() / 2 )->Key << endl;
+	}
+
+	/// 㷨ͼ14.4е
+	void testIntervalTree()
+	{
+		int intervals[][2] = { {16, 21}, {8, 9}, {25, 30}, {5, 8}, {15, 23}, {17, 19}, {26, 26}, {0, 3}, {6, 10}, {19, 20} };
+		IntervalTree<int, int> tree;
+		for ( size_t i = 0; i < sizeof( intervals ) / sizeof( intervals[0] ); ++i )
+		{
+			tree.Insert( intervals[i][0], intervals[i][1], static_cast<int>( i ) );
+		}
+
+		int queries[][2] = { {22, 25}, {11, 14}, {8, 17} };
+		for ( size_t i = 0; i < sizeof( queries ) / sizeof( queries[0] ); ++i )
+		{
+			cout << "[" << queries[i][0] << ", " << queries[i][1] << "]ص䣺";
+			auto node = tree.Overlaps( queries[i][0], queries[i][1] );
+			if ( node )
+			{
+				cout << "[" << node->Key.first << ", " << node->Key.second << "]ȫΪ";
+				tree.Overlaps( queries[i][0], queries[i][1], [&]( IntervalTree<int, int>::RBTreeNode *node )
+				{
+					cout << "[" << node->Key.first << ", " << node->Key.second << "] ";
+				} );
+				cout << endl;
+			}
+			else
+			{
+				cout << "" << endl;
+			}
+		}
+	}
+
+	/// ļ㣺ȽJoinĲUnion֤ĴС
+	void testRBTreeSetOperations()
+	{
+		int const n = 1000000;
+		RBTree<int, int> multiples_of_2, multiples_of_3;
+		for ( int i = 0; i < n; ++i )
+		{
+			multiples_of_2.Insert( i * 2, i );
+			multiples_of_3.Insert( i * 3, i );
+		}
+		//еļǲ2(n - 1)6ı
+		size_t common = ( 2 * static_cast<size_t>( n ) - 2 ) / 6 + 1;
+
+		auto time_it = []( function<void ()> func ) -> double
+		{
+			auto start = chrono::steady_clock::now();
+			func();
+			return chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count();
+		};
+
+		{
+			RBTree<int, int> tree;
+			tree.Union( multiples_of_2 );
+			double insert_time = time_it( [&]()
+			{
+				for ( int i = 0; i < n; ++i )
+				{
+					tree.Insert( i * 3, i );
+				}
+			} );
+			cout << "󲢼" << insert_time << "msԪظ" << tree.Size() << endl;
+		}
+
+		size_t const thread_counts[] = { 1, 2, 4, 8 };
+		for ( size_t i = 0; i < sizeof( thread_counts ) / sizeof( thread_counts[0] ); ++i )
+		{
+			RBTree<int, int> tree;
+			tree.Union( multiples_of_2 );
+			double union_time = time_it( [&]()
+			{
+				tree.Union( multiples_of_3, thread_counts[i] );
+			} );
+			cout << thread_counts[i] << "߳󲢼" << union_time << "msԪظ" << tree.Size()
+				<< "ӦΪ" << 2 * n - common << "" << endl;
+		}
+
+		RBTree<int, int> intersection;
+		intersection.Union( multiples_of_2 );
+		intersection.Intersection( multiples_of_3 );
+		cout << "Ԫظ" << intersection.Size() << "ӦΪ" << common << "" << endl;
+
+		RBTree<int, int> difference;
+		difference.Union( multiples_of_2 );
+		difference.Difference( multiples_of_3 );
+		cout << "Ԫظ" << difference.Size() << "ӦΪ" << n - common << "" << endl;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,306 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		robin_hood_hash_map.h
+/// @brief		ѰַRobin Hood̽飩ɢбֽ֧ʽ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "universal_hash.h"
+using namespace std;
+
+namespace ita
+{
+    /// @brief ѰַɢбRobin Hood̽飩
+    ///
+    /// UniversalHashTableʹӷÿԪصnewһ㣬۵ĸ̶Ϊ10ԪһҾ˻ɱ
+    /// RobinHoodHashMapĿѰַ汾
+    /// - еԪֱӴڲУؼֱֵ֡̽飬ʱֻ˳ɨ輸ڵĲۣ
+    /// - ʹ̽飬Robin HoodԣʱһԼġҡɢֵָĲۣԪأλã
+    ///   Ԫص̽붼ȽƽʧʱֻҪ̽ԼСԪؾͿֹͣ
+    /// - ɾʱѺԪǰƶһbackward shiftҪɾǣ
+    /// - װӳMaxLoadFactorʱ۵ĸΪ˲ĳһβеȫɢУǽģ
+    ///   ɵĲ鱣˺ÿβɾ˳Ѿеɸ۰ᵽУ֮ͷž顣
+    ///   ڰǨ֮ǰҪͬʱ¾顣
+    ///
+    /// ɢкUniversalHashTableȫɢУʱѡȡabUniversalHashFunction
+    /// @param	KeyType		ؼֵͣǲ64λ
+    /// @param	ValueType	ֵ
+    template<typename KeyType, typename ValueType>
+    class RobinHoodHashMap
+    {
+    public:
+        /// һյɢбͬʱȫɢкѡһɢк
+        explicit RobinHoodHashMap( size_t initial_capacity = 16 ) : _old_position( 0 ), _size( 0 )
+        {
+            size_t capacity = 8;
+            while ( capacity < initial_capacity )
+            {
+                capacity *= 2;
+            }
+            _table.Resize( capacity );
+        }
+
+        /// @brief һԪ
+        ///
+        /// @return	trueʾµԪأfalseʾؼѾڣֵֻ
+        bool Insert( KeyType const &key, ValueType const &value )
+        {
+            ValueType *existed = Search( key );
+            if ( existed )
+            {
+                *existed = value;
+                return false;
+            }
+
+            if ( _size + 1 > _table.Capacity() * MaxLoadFactor() )
+            {
+                _Grow();
+            }
+            _table.Insert( key, value, _hash( static_cast<uint64_t>( key ) ) );
+            ++_size;
+            _MigrateStep();
+            return true;
+        }
+
+        /// @brief ɾһԪ
+        ///
+        /// @return	ǷɹɾԪ
+        bool Delete( KeyType const &key )
+        {
+            uint64_t hash = _hash( static_cast<uint64_t>( key ) );
+            bool deleted = _table.Delete( key, hash, 0 ) || ( _old.Capacity() > 0 && _old.Delete( key, hash, _old_position ) );
+            if ( deleted )
+            {
+                --_size;
+                _MigrateStep();
+            }
+            return deleted;
+        }
+
+        /// ɢбһԪأֵָ룬Ҳʱnullptr
+        ValueType * Search( KeyType const &key )
+        {
+            uint64_t hash = _hash( static_cast<uint64_t>( key ) );
+            size_t pos = _table.Find( key, hash, 0 );
+            if ( pos != _NotFound() )
+            {
+                return &_table.Values[pos];
+            }
+            if ( _old.Capacity() > 0 )
+            {
+                pos = _old.Find( key, hash, _old_position );
+                if ( pos != _NotFound() )
+                {
+                    return &_old.Values[pos];
+                }
+            }
+            return nullptr;
+        }
+
+        /// Ԫصĸ
+        size_t Size() const
+        {
+            return _size;
+        }
+
+        /// ۵ĸڰǨľ飩
+        size_t Capacity() const
+        {
+            return _table.Capacity();
+        }
+
+        /// ݵֵ
+        static double MaxLoadFactor()
+        {
+            return 0.8;
+        }
+
+        /// ɢбееԪʾ
+        void Display() const
+        {
+            for ( size_t i = 0; i < _table.Capacity(); ++i )
+            {
+                cout << "[" << setw( 3 ) << i << setw( 3 ) << "]";
+                if ( _table.Distances[i] )
+                {
+                    cout << " " << _table.Keys[i] << " -> " << _table.Values[i] << " (̽" << _table.Distances[i] - 1 << ")";
+                }
+                cout << endl;
+            }
+        }
+
+    private:
+        /// @brief һ
+        ///
+        /// Distances[i] == 0ʾiΪգDistances[i] - 1ΪiеԪصġҡľ
+        struct _Table
+        {
+            vector<KeyType>			Keys;
+            vector<ValueType>		Values;
+            vector<uint32_t>		Distances;
+
+            size_t Capacity() const
+            {
+                return Distances.size();
+            }
+
+            void Resize( size_t capacity )
+            {
+                Keys.assign( capacity, KeyType() );
+                Values.assign( capacity, ValueType() );
+                Distances.assign( capacity, 0 );
+            }
+
+            void Release()
+            {
+                vector<KeyType>().swap( Keys );
+                vector<ValueType>().swap( Values );
+                vector<uint32_t>().swap( Distances );
+            }
+
+            /// @brief ҹؼڵĲ
+            ///
+            /// [0, skip)ΧڵĲѾǨˣѾǿյģΪ̽ı־ֻ
+            size_t Find( KeyType const &key, uint64_t hash, size_t skip ) const
+            {
+                size_t mask = Capacity() - 1;
+                size_t pos = static_cast<size_t>( hash ) & mask;
+                for ( uint32_t distance = 1; distance <= Capacity(); ++distance, pos = ( pos + 1 ) & mask )
+                {
+                    if ( pos < skip )
+                    {
+                        continue;
+                    }
+                    //ղۣһԼҵԪأkeyڣӦ֮ǰ
+                    if ( Distances[pos] < distance )
+                    {
+                        return _NotFound();
+                    }
+                    if ( Distances[pos] == distance && Keys[pos] == key )
+                    {
+                        return pos;
+                    }
+                }
+                return _NotFound();
+            }
+
+            /// һһڵĹؼ
+            void Insert( KeyType key, ValueType value, uint64_t hash )
+            {
+                size_t mask = Capacity() - 1;
+                size_t pos = static_cast<size_t>( hash ) & mask;
+                uint32_t distance = 1;
+                for ( ;; )
+                {
+                    if ( Distances[pos] == 0 )
+                    {
+                        Keys[pos] = key;
+                        Values[pos] = value;
+                        Distances[pos] = distance;
+                        return;
+                    }
+                    if ( Distances[pos] < distance )
+                    {
+                        //ٸƶǰеԪҸѲøҸԶԪأȻΪԪλ
+                        std::swap( key, Keys[pos] );
+                        std::swap( value, Values[pos] );
+                        std::swap( distance, Distances[pos] );
+                    }
+                    pos = ( pos + 1 ) & mask;
+                    ++distance;
+                }
+            }
+
+            /// ɾһؼ֣ѺԪǰƶһ
+            bool Delete( KeyType const &key, uint64_t hash, size_t skip )
+            {
+                size_t pos = Find( key, hash, skip );
+                if ( pos == _NotFound() )
+                {
+                    return false;
+                }
+
+                size_t mask = Capacity() - 1;
+                size_t next = ( pos + 1 ) & mask;
+                while ( Distances[next] > 1 )
+                {
+                    Keys[pos] = Keys[next];
+                    Values[pos] = Values[next];
+                    Distances[pos] = Distances[next] - 1;
+                    pos = next;
+                    next = ( next + 1 ) & mask;
+                }
+                Distances[pos] = 0;
+                Values[pos] = ValueType();
+                return true;
+            }
+        };
+
+        /// ʾʧܵĲ۱
+        static size_t _NotFound()
+        {
+            return static_cast<size_t>( -1 );
+        }
+
+        /// ۵ĸǰΪڰǨľ
+        void _Grow()
+        {
+            //һݻûа꣬һ԰
+            while ( _old.Capacity() > 0 )
+            {
+                _MigrateStep();
+            }
+
+            std::swap( _old, _table );
+            _old_position = 0;
+            _table.Resize( _old.Capacity() * 2 );
+        }
+
+        /// Ѿеɸ۰ᵽУȫͷž
+        void _MigrateStep()
+        {
+            if ( _old.Capacity() == 0 )
+            {
+                return;
+            }
+
+            size_t const slots_per_step = 16;
+            size_t end = min( _old_position + slots_per_step, _old.Capacity() );
+            for ( ; _old_position < end; ++_old_position )
+            {
+                if ( _old.Distances[_old_position] )
+                {
+                    KeyType const &key = _old.Keys[_old_position];
+                    _table.Insert( key, _old.Values[_old_position], _hash( static_cast<uint64_t>( key ) ) );
+                    _old.Distances[_old_position] = 0;
+                }
+            }
+
+            if ( _old_position == _old.Capacity() )
+            {
+                _old.Release();
+                _old_position = 0;
+            }
+        }
+
+        UniversalHashFunction	_hash;			///< ȫɢк
+        _Table					_table;			///< ǰĲ飬۵ĸ2
+        _Table					_old;			///< ڰǨľɲ飬ûаǨʱΪ
+        size_t					_old_position;	///< [0, _old_position)ĲѾǨ
+        size_t					_size;			///< Ԫصĸ
+    };
+}
\ No newline at end of file
@@ -0,0 +1,498 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		static_search_tree.h
+/// @brief		̬һֻĶEytzingervan Emde Boas˳һ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace ita
+{
+    /// ̬еĲ
+    enum StaticTreeLayout
+    {
+        Eytzinger,			///< ˳򣨿ȣţȫнkӽΪ2k2k+1
+        VanEmdeBoas			///< ߶һΪϰÿһԵݹ
+    };
+
+    /// @brief ̬
+    ///
+    /// BinarySearchTreeĽָͨӣʱÿ½һ㶼һԤķô档ڽֻ֮Ĳұ
+    /// StaticSearchTreeȫ㰴ĳ˳һУ
+    /// - EytzingeršؼֽȫҪӽ±꣬½һk = 2k + (key[k] < x)
+    ///   ǰ㼯ĿͷڻУ
+    /// - VanEmdeBoas߶Ϊhֳɸ߶Ϊh/2ϰɿø߶Ϊh - h/2ÿһָԵݹš
+    ///   ۻУҳжһβҾĻO(log_B n)ν޹أcache-oblivious
+    ///   ȫͬҪӽ±꣺ıkճ㣬kеλԤõÿһõ_ToVanEmdeBoas
+    ///
+    /// ״ؼֽȫҲŶrootʱƽ⣬ֻʽشӽ±꣩\n
+    /// ҵѭֻûڱȽϽķ֧ȽϽֱΪӽ±ָ꣬\n
+    /// ҵĽǹؼеλãȣȥ±Լֵ顣
+    /// @param	KeyType		ؼֵͣҪ֧<
+    /// @see	class BinarySearchTree
+    template<typename KeyType>
+    class StaticSearchTree
+    {
+    public:
+        /// @brief ϸĹؼֽһƽľ̬
+        ///
+        /// @param	sorted_keys	ϸĹؼ
+        /// @param	layout		ַʽ
+        explicit StaticSearchTree( vector<KeyType> const &sorted_keys, StaticTreeLayout layout = Eytzinger )
+            : _layout( layout ), _size( sorted_keys.size() ), _height( 0 ), _implicit( true ), _root_slot( 0 )
+        {
+            _CheckSorted( sorted_keys );
+
+            _BuildImplicit( sorted_keys );
+            if ( layout == VanEmdeBoas )
+            {
+                _ToVanEmdeBoas();
+            }
+        }
+
+        /// @brief Ŷroot̬
+        ///
+        /// @param	sorted_keys	ϸĹؼk1, k2, ..., knsorted_keys[0...n-1]У
+        /// @param	root		ͬrootroot[i][j]1 <= i <= j <= nΪki...kjɵĸı
+        /// @param	layout		ַʽEytzingerʱŲʽؼ¼ӽ±
+        StaticSearchTree( vector<KeyType> const &sorted_keys, vector<vector<int>> const &root, StaticTreeLayout layout = VanEmdeBoas )
+            : _layout( layout ), _size( sorted_keys.size() ), _height( 0 ), _implicit( false ), _root_slot( 0 )
+        {
+            _CheckSorted( sorted_keys );
+
+            //Ŷܺܲƽ⣬ʽջݹ
+            vector<uint32_t> left( _size, _Nil() ), right( _size, _Nil() );
+            uint32_t tree_root = _Nil();
+            vector<pair<pair<size_t, size_t>, uint32_t *>> stack;
+            stack.push_back( make_pair( make_pair( static_cast<size_t>( 1 ), _size ), &tree_root ) );
+            while ( !stack.empty() )
+            {
+                size_t i = stack.back().first.first;
+                size_t j = stack.back().first.second;
+                uint32_t *link = stack.back().second;
+                stack.pop_back();
+                if ( i <= j )
+                {
+                    if ( i >= root.size() || j >= root[i].size() || root[i][j] < static_cast<int>( i ) || root[i][j] > static_cast<int>( j ) )
+                    {
+                        throw exception( "rootroot[i][j][i, j]֮" );
+                    }
+                    size_t r = static_cast<size_t>( root[i][j] );
+                    *link = static_cast<uint32_t>( r - 1 );
+                    stack.push_back( make_pair( make_pair( i, r - 1 ), &left[r - 1] ) );
+                    stack.push_back( make_pair( make_pair( r + 1, j ), &right[r - 1] ) );
+                }
+            }
+            _BuildExplicit( sorted_keys, tree_root, left, right );
+        }
+
+        /// һСkeyĹؼֵȣеĹؼֶСkeyʱSize()
+        size_t LowerBound( KeyType const &key ) const
+        {
+            size_t slot = _LowerBoundSlot( key );
+            return slot == 0 ? _size : _RankOf( slot );
+        }
+
+        /// ؼkeyȣʱSize()
+        size_t Find( KeyType const &key ) const
+        {
+            size_t slot = _LowerBoundSlot( key );
+            return ( slot == 0 || key < _KeyOf( slot ) ) ? _size : _RankOf( slot );
+        }
+
+        /// Ƿڹؼkey
+        bool Search( KeyType const &key ) const
+        {
+            return Find( key ) != _size;
+        }
+
+        /// ؼֵĸ
+        size_t Size() const
+        {
+            return _size;
+        }
+
+        /// ĸ߶ȣΪ0
+        size_t Height() const
+        {
+            return _height;
+        }
+
+        /// ַʽ
+        StaticTreeLayout Layout() const
+        {
+            return _layout;
+        }
+
+        /// дŵ˳геĹؼ
+        vector<KeyType> LayoutKeys() const
+        {
+            vector<KeyType> keys;
+            size_t slot_count = ( _implicit ? _keys.size() : _nodes.size() );
+            for ( size_t slot = 1; slot < slot_count; ++slot )
+            {
+                if ( !_implicit || _ranks[slot] != _Nil() )
+                {
+                    keys.push_back( _KeyOf( slot ) );
+                }
+            }
+            return keys;
+        }
+
+    private:
+        /// ʽӽ±Ľ㣬±0ʾ
+        struct _Node
+        {
+            KeyType		Key;		///< ؼ
+            uint32_t	Rank;		///< ؼеλ
+            uint32_t	Child[2];	///< ӽе±
+        };
+
+        /// ʽvan Emde BoasһȵĲ
+        struct _VebLevel
+        {
+            size_t	TopDepth;		///< һΪ°Ӧϰĸ
+            size_t	TopSize;		///< ϰĽ
+            size_t	BottomSize;		///< ÿһ°Ľ
+
+            _VebLevel() : TopDepth( 1 ), TopSize( 0 ), BottomSize( 0 )
+            {
+
+            }
+        };
+
+        /// ʱʾս
+        static uint32_t _Nil()
+        {
+            return static_cast<uint32_t>( -1 );
+        }
+
+        static void _CheckSorted( vector<KeyType> const &keys )
+        {
+            if ( keys.size() >= _Nil() )
+            {
+                throw exception( "ؼ̫" );
+            }
+            for ( size_t i = 1; i < keys.size(); ++i )
+            {
+                if ( !( keys[i - 1] < keys[i] ) )
+                {
+                    throw exception( "ؼֱϸ" );
+                }
+            }
+        }
+
+        /// xĶƱʾĩβ1ĸ
+        static size_t _TrailingOnes( size_t x )
+        {
+#ifdef _MSC_VER
+            unsigned long index;
+#ifdef _WIN64
+            _BitScanForward64( &index, ~x );
+#else
+            _BitScanForward( &index, static_cast<unsigned long>( ~x ) );
+#endif
+            return index;
+#else
+            return static_cast<size_t>( __builtin_ctzll( ~static_cast<unsigned long long>( x ) ) );
+#endif
+        }
+
+        /// ԤȡһַڵĻУַķΧҲûйϵ
+        static void _Prefetch( void const *address )
+        {
+#ifdef _MSC_VER
+            _mm_prefetch( static_cast<char const *>( address ), _MM_HINT_T0 );
+#else
+            __builtin_prefetch( address );
+#endif
+        }
+
+        /// @brief ҵһСkeyĹؼڵλãʱ0
+        ///
+        /// ʽEytzinger֣һֱ½Ҷ֮£kĶƱʾ¼ÿһ0ң1
+        /// һ֮ȫңȥĩβ1һ0ʣµľһߵǸ㡣\n
+        /// ʽĲ֣;סһСkeyĽ㡣
+        size_t _LowerBoundSlot( KeyType const &key ) const
+        {
+            if ( _implicit && _layout == Eytzinger )
+            {
+                KeyType const *keys = _keys.data();
+                size_t k = 1;
+                while ( k <= _size )
+                {
+                    //4֮16ģǰǶ뻺
+                    _Prefetch( keys + 16 * k );
+                    k = 2 * k + static_cast<size_t>( keys[k] < key );
+                }
+                return k >> ( _TrailingOnes( k ) + 1 );
+            }
+
+            if ( _implicit )
+            {
+                //position[d]Ϊ·ΪdĽе±꣬ؼ2^32߲32
+                KeyType const *keys = _keys.data();
+                _VebLevel const *levels = _levels.data();
+                size_t position[34];
+                position[1] = 1;
+                size_t result = 0;
+                size_t k = 1;
+                for ( size_t depth = 1; k <= _size; ++depth )
+                {
+                    size_t slot = position[depth];
+                    size_t go_right = static_cast<size_t>( keys[slot] < key );
+                    result = go_right ? result : slot;
+                    k = 2 * k + go_right;
+                    _VebLevel const &level = levels[depth + 1];
+                    position[depth + 1] = position[level.TopDepth] + level.TopSize + ( k & level.TopSize ) * level.BottomSize;
+                }
+                return result;
+            }
+
+            _Node const *nodes = _nodes.data();
+            size_t result = 0;
+            size_t slot = _root_slot;
+            while ( slot != 0 )
+            {
+                _Node const &node = nodes[slot];
+                size_t go_right = static_cast<size_t>( node.Key < key );
+                result = go_right ? result : slot;
+                slot = node.Child[go_right];
+            }
+            return result;
+        }
+
+        KeyType const & _KeyOf( size_t slot ) const
+        {
+            return _implicit ? _keys[slot] : _nodes[slot].Key;
+        }
+
+        size_t _RankOf( size_t slot ) const
+        {
+            return _implicit ? _ranks[slot] : _nodes[slot].Rank;
+        }
+
+        /// ȫʽEytzinger֣±1...nĹؼ
+        void _BuildImplicit( vector<KeyType> const &sorted_keys )
+        {
+            _keys.assign( _size + 1, KeyType() );
+            _ranks.assign( _size + 1, 0 );
+
+            size_t rank = 0;
+            size_t k = 1;
+            vector<size_t> stack;
+            while ( k <= _size || !stack.empty() )
+            {
+                while ( k <= _size )
+                {
+                    stack.push_back( k );
+                    k = 2 * k;
+                }
+                k = stack.back();
+                stack.pop_back();
+                _keys[k] = sorted_keys[rank];
+                _ranks[k] = static_cast<uint32_t>( rank++ );
+                k = 2 * k + 1;
+            }
+
+            for ( size_t n = _size; n > 0; n /= 2 )
+            {
+                ++_height;
+            }
+        }
+
+        /// @brief ʽEytzingerΪʽvan Emde Boas
+        ///
+        /// ȫɸ߶ΪHһȱٵĽգڸ߶ΪhһλУ
+        /// °벿ֵĸĸͬһdd¼
+        /// - TopDepthϰĸȣ
+        /// - TopSizeϰĽ2^t - 1ͬʱҲȡkĵtλ룬k & TopSizekλڵڼ°
+        /// - BottomSizeÿһ°Ľ
+        ///
+        /// ΪdĽkλ = TopDepthȵλ + TopSize + (k & TopSize) * BottomSize
+        /// ʱȵλѾ¼·ϣÿ½һֻһγ˷һμӷ
+        void _ToVanEmdeBoas()
+        {
+            _levels.assign( _height + 2, _VebLevel() );
+            if ( _height > 0 )
+            {
+                _SplitLevels( 1, _height );
+            }
+
+            //˳ÿλãȵλڽ
+            vector<size_t> position( _size + 1, 0 );
+            vector<KeyType> keys( ( static_cast<size_t>( 1 ) << _height ), KeyType() );
+            vector<uint32_t> ranks( keys.size(), _Nil() );
+            size_t depth = 0;
+            for ( size_t k = 1; k <= _size; ++k )
+            {
+                if ( ( k & ( k - 1 ) ) == 0 )
+                {
+                    ++depth;
+                }
+                if ( k == 1 )
+                {
+                    position[k] = 1;
+                }
+                else
+                {
+                    _VebLevel const &level = _levels[depth];
+                    position[k] = position[k >> ( depth - level.TopDepth )] + level.TopSize + ( k & level.TopSize ) * level.BottomSize;
+                }
+                keys[position[k]] = _keys[k];
+                ranks[position[k]] = _ranks[k];
+            }
+            _keys.swap( keys );
+            _ranks.swap( ranks );
+        }
+
+        /// ԸΪtop_depth߶Ϊheightݹػ֣¼°벿ֵĸȵĲ
+        void _SplitLevels( size_t top_depth, size_t height )
+        {
+            if ( height == 1 )
+            {
+                return;
+            }
+
+            size_t top_height = height / 2;
+            size_t bottom_depth = top_depth + top_height;
+            _levels[bottom_depth].TopDepth = top_depth;
+            _levels[bottom_depth].TopSize = ( static_cast<size_t>( 1 ) << top_height ) - 1;
+            _levels[bottom_depth].BottomSize = ( static_cast<size_t>( 1 ) << ( height - top_height ) ) - 1;
+            _SplitLevels( top_depth, top_height );
+            _SplitLevels( bottom_depth, height - top_height );
+        }
+
+        /// ַʽleft/rightΪ㣩ŵ_nodes
+        void _BuildExplicit( vector<KeyType> const &sorted_keys, uint32_t root, vector<uint32_t> const &left, vector<uint32_t> const &right )
+        {
+            _nodes.assign( _size + 1, _Node() );
+            _root_slot = 0;
+            if ( root == _Nil() )
+            {
+                return;
+            }
+
+            //ĸ߶
+            vector<pair<uint32_t, size_t>> stack( 1, make_pair( root, static_cast<size_t>( 1 ) ) );
+            while ( !stack.empty() )
+            {
+                pair<uint32_t, size_t> top = stack.back();
+                stack.pop_back();
+                _height = max( _height, top.second );
+                if ( left[top.first] != _Nil() )
+                {
+                    stack.push_back( make_pair( left[top.first], top.second + 1 ) );
+                }
+                if ( right[top.first] != _Nil() )
+                {
+                    stack.push_back( make_pair( right[top.first], top.second + 1 ) );
+                }
+            }
+
+            vector<uint32_t> order;
+            order.reserve( _size );
+            if ( _layout == Eytzinger )
+            {
+                order.push_back( root );
+                for ( size_t i = 0; i < order.size(); ++i )
+                {
+                    _AppendChildren( order[i], left, right, order );
+                }
+            }
+            else
+            {
+                _VanEmdeBoasOrder( root, _height, left, right, order );
+            }
+
+            //order[i]±i + 1
+            vector<uint32_t> slot_of( _size );
+            for ( size_t i = 0; i < order.size(); ++i )
+            {
+                slot_of[order[i]] = static_cast<uint32_t>( i + 1 );
+            }
+            for ( size_t i = 0; i < order.size(); ++i )
+            {
+                uint32_t rank = order[i];
+                _Node &node = _nodes[i + 1];
+                node.Key = sorted_keys[rank];
+                node.Rank = rank;
+                node.Child[0] = ( left[rank] == _Nil() ? 0 : slot_of[left[rank]] );
+                node.Child[1] = ( right[rank] == _Nil() ? 0 : slot_of[right[rank]] );
+            }
+            _root_slot = slot_of[root];
+        }
+
+        static void _AppendChildren( uint32_t node, vector<uint32_t> const &left, vector<uint32_t> const &right, vector<uint32_t> &out )
+        {
+            if ( left[node] != _Nil() )
+            {
+                out.push_back( left[node] );
+            }
+            if ( right[node] != _Nil() )
+            {
+                out.push_back( right[node] );
+            }
+        }
+
+        /// @brief rootΪֻȡǰheightvan Emde Boas˳
+        ///
+        /// ݹֻڸ߶϶԰֣ΪO(lg height)ʹ˻ΪҲջ
+        static void _VanEmdeBoasOrder( uint32_t root, size_t height, vector<uint32_t> const &left, vector<uint32_t> const &right, vector<uint32_t> &order )
+        {
+            if ( height == 1 )
+            {
+                order.push_back( root );
+                return;
+            }
+
+            size_t top_height = height / 2;
+            _VanEmdeBoasOrder( root, top_height, left, right, order );
+
+            //ϰ֮µĸĸ
+            vector<uint32_t> level( 1, root );
+            for ( size_t depth = 0; depth < top_height && !level.empty(); ++depth )
+            {
+                vector<uint32_t> next;
+                for ( size_t i = 0; i < level.size(); ++i )
+                {
+                    _AppendChildren( level[i], left, right, next );
+                }
+                level.swap( next );
+            }
+            for ( size_t i = 0; i < level.size(); ++i )
+            {
+                _VanEmdeBoasOrder( level[i], height - top_height, left, right, order );
+            }
+        }
+
+        StaticTreeLayout	_layout;		///< ַʽ
+        size_t				_size;			///< ؼֵĸ
+        size_t				_height;		///< ĸ߶
+        bool				_implicit;		///< ǷΪӽ±ȫ
+        vector<KeyType>		_keys;			///< ʽ֣λϵĹؼ֣±1ʼ
+        vector<uint32_t>	_ranks;			///< ʽ֣λϵĹؼֵȣvEBпŵλΪ_Nil()
+        vector<_VebLevel>	_levels;		///< ʽvan Emde Boas֣ÿһȵĲ±Ϊ
+        vector<_Node>		_nodes;			///< ʽ֣±1...nĽ㣬±0
+        size_t				_root_slot;		///< ʽ֣±
+    };
+}
\ No newline at end of file
@@ -20,8 +20,12 @@
 #include <set>
 #include <iterator>
 #include <bitset>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
 #include "graphics.h"
 #include "deapth_first_search.h"
+#include "strongly_connected_component.h"
 
 using namespace std;
 
@@ -60,69 +64,194 @@ namespace ita
         g.Link2Vertex( 6, 7 );
         g.Link2Vertex( 7, 7 );
 
-        //step1:gȱ
-        vector<int>		d( g.GetVertex().size() );				//ʱd
-        vector<int>		f( g.GetVertex().size() );				//ʱf
-        vector<bool>	traversed( g.GetVertex().size(), false );	//ʶǷѾ
-        int				time = 0;
-
-        for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+        //step1:gȱɵȺ¶
+        struct FinishOrderVisitor : public DFSVisitor
         {
-            if ( !traversed[i] )
+            vector<size_t>	Finished;
+
+            void FinishVertex( size_t u, int )
             {
-                DFS_Visit( g, i, d, f, traversed, time );
+                Finished.push_back( u );
             }
-        }
+        } finish_order;
 
-        //step2:õgTõʱf
-        GraphicsViaAdjacencyList<char> gT( g );
-        for ( size_t i = 0; i < gT.GetEdges().size(); ++i )
+        vector<int>		d;				//ʱd
+        vector<int>		f;				//ʱf
+        DFS( g, d, f, finish_order );
+
+        //step2:õgTʱf˳˳򣬲Ҫ
+        GraphicsViaAdjacencyList<char> gT( g.GetVertex(), Digraph );
+        vector<pair<size_t, size_t>> edges = g.GetAllEdges();
+        for ( size_t i = 0; i < edges.size(); ++i )
+        {
+            gT.Link2Vertex( edges[i].second, edges[i].first );
+        }
+        for ( size_t i = finish_order.Finished.size(); i > 0; --i )
         {
-            gT.GetEdges()[i] = nullptr;
+            size_t u = finish_order.Finished[i - 1];
+            cout << g.GetVertex()[u] << "[" << d[u] << "," << f[u] << "] ";
         }
-        for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+        cout << endl;
+
+        //step3gTʱ½ȱõĸgǿ֧ͨ
+        struct ComponentVisitor : public DFSVisitor
+        {
+            vector<size_t>	Members;
+
+            void DiscoverVertex( size_t u, int )
+            {
+                Members.push_back( u );
+            }
+        } component;
+
+        d.assign( gT.GetVertex().size(), 0 );
+        f.assign( gT.GetVertex().size(), 0 );
+        int time = 0;
+        for ( size_t i = finish_order.Finished.size(); i > 0; --i )
         {
-            for ( size_t j = 0; j < g.GetVertex().size(); ++j )
+            size_t root = finish_order.Finished[i - 1];
+            if ( d[root] == 0 )
             {
-                if ( g.IsLinked( i, j ).first )
+                component.Members.clear();
+                DFS_Visit( gT, root, d, f, time, component );
+                for ( size_t k = 0; k < component.Members.size(); ++k )
                 {
-                    gT.Link2Vertex( j, i );
+                    cout << gT.GetVertex()[component.Members[k]];
                 }
+                cout << endl;
             }
         }
-        vector<pair<int, pair<int, int>>> r;
-        for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+
+        //Tarjan㷨һȱ֧ıžͼ
+        vector<int> component_of;
+        size_t count = TarjanStronglyConnectedComponent( g, component_of );
+        CondensationGraph dag( g, component_of, count );
+        cout << "Tarjan㷨õ" << count << "ǿ֧ͨͼ" << dag.EdgeCount() << "" << endl;
+        for ( size_t c = 0; c < count; ++c )
         {
-            r.push_back( make_pair( i, make_pair( d[i], f[i] ) ) );
+            cout << c << "";
+            for ( auto it = dag.MemberBegin( c ); it != dag.MemberEnd( c ); ++it )
+            {
+                cout << g.GetVertex()[*it];
+            }
+            cout << " ->";
+            for ( auto it = dag.SuccessorBegin( c ); it != dag.SuccessorEnd( c ); ++it )
+            {
+                cout << " " << *it;
+            }
+            cout << endl;
         }
-        //ʱfźĽ
-        sort( r.rbegin(), r.rend(), []( pair<int, pair<int, int>> const & p1, pair<int, pair<int, int>> const & p2 )
+    }
+
+    /// ĴͼϱȽKosaraju㷨ȱӷڽͼTarjan㷨벢е޼ǰ㷨
+    void StronglyConnectedComponentBenchmark()
+    {
+        size_t const n = 1 << 20;
+        size_t const edge_count = 2 * n;
+        auto random_index = [n]()
         {
-            return p1.second.second < p2.second.second;
-        } );
-        for ( size_t i = 0; i < r.size(); ++i )
+            return ( static_cast<size_t>( rand() ) * ( RAND_MAX + 1u ) + static_cast<size_t>( rand() ) ) % n;
+        };
+
+        vector<int> v( n );
+        GraphicsViaAdjacencyList<int> list( v, Digraph );
+        for ( size_t i = 0; i < edge_count; ++i )
         {
-            cout << g.GetVertex()[r[i].first] << "[" << r[i].second.first << "," << r[i].second.second << "] ";
+            list.Link2Vertex( random_index(), random_index() );
         }
-        cout << endl;
+        GraphicsViaCompressedSparseRow<int> g( list );
+        cout << n << "㣬" << edge_count << "" << endl;
 
-        //step3gTʱ½ȱõĸgǿ֧ͨ
-        traversed.assign( gT.GetVertex().size(), false );
-        time = 0;
+        //Kosaraju㷨ɵڷڽͼϱͼ
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        struct FinishOrderVisitor : public DFSVisitor
+        {
+            vector<size_t>	Finished;
 
-        for ( size_t i = 0; i < r.size(); ++i )
+            void FinishVertex( size_t u, int )
+            {
+                Finished.push_back( u );
+            }
+        } finish_order;
+        vector<int> d, f;
+        DFS( g, d, f, finish_order );
+        ReverseAdjacency reverse( g );
+        vector<int> expected( n, -1 );
+        vector<size_t> stack;
+        int expected_count = 0;
+        for ( size_t i = n; i > 0; --i )
         {
-            if ( !traversed[r[i].first] )
+            size_t root = finish_order.Finished[i - 1];
+            if ( expected[root] >= 0 )
             {
-                vector<int> ids = DFS_Visit( gT, r[i].first, d, f, traversed, time );
-                for ( size_t k = 0; k < ids.size(); ++k )
+                continue;
+            }
+            expected[root] = expected_count;
+            stack.push_back( root );
+            while ( !stack.empty() )
+            {
+                size_t u = stack.back();
+                stack.pop_back();
+                for ( auto it = reverse.PredecessorBegin( u ); it != reverse.PredecessorEnd( u ); ++it )
                 {
-                    cout << gT.GetVertex()[ids[k]];
+                    if ( expected[*it] < 0 )
+                    {
+                        expected[*it] = expected_count;
+                        stack.push_back( *it );
+                    }
                 }
-                cout << endl;
             }
+            ++expected_count;
         }
+        cout << "    Kosaraju㷨" << chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count() << "ms" << expected_count << "ǿ֧ͨ" << endl;
 
-    }
+        start = chrono::steady_clock::now();
+        vector<int> component;
+        size_t count = TarjanStronglyConnectedComponent( g, component );
+        double elapsed = chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count();
+
+        //㷨ĳ֧ţһֻͬͬһ
+        bool correct = ( count == static_cast<size_t>( expected_count ) );
+        vector<int> mapping( count, -1 );
+        for ( size_t i = 0; i < n && correct; ++i )
+        {
+            if ( mapping[component[i]] < 0 )
+            {
+                mapping[component[i]] = expected[i];
+            }
+            correct = ( mapping[component[i]] == expected[i] );
+        }
+        cout << "    Tarjan㷨" << elapsed << "ms" << count << "ǿ֧ͨ" << ( correct ? "ȷ" : "" ) << endl;
 
+        //еǰ㷨Tarjan㷨ĽȽ
+        size_t const max_threads = max( thread::hardware_concurrency(), 1u );
+        for ( size_t threads = 1; threads <= max_threads; threads *= 2 )
+        {
+            start = chrono::steady_clock::now();
+            vector<int> parallel;
+            size_t parallel_count = ParallelStronglyConnectedComponent( g, parallel, threads, &reverse );
+            elapsed = chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count();
+
+            correct = ( parallel_count == count );
+            mapping.assign( count, -1 );
+            for ( size_t i = 0; i < n && correct; ++i )
+            {
+                if ( mapping[component[i]] < 0 )
+                {
+                    mapping[component[i]] = parallel[i];
+                }
+                correct = ( mapping[component[i]] == parallel[i] );
+            }
+            cout << "    ޼ǰ" << threads << "̣߳" << elapsed << "ms" << parallel_count << "ǿ֧ͨ" << ( correct ? "ȷ" : "" ) << endl;
+        }
+
+        start = chrono::steady_clock::now();
+        CondensationGraph dag( g, component, count );
+        size_t largest = 0;
+        for ( size_t c = 0; c < count; ++c )
+        {
+            largest = max( largest, dag.ComponentSize( c ) );
+        }
+        cout << "    ͼ" << chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count() << "ms" << dag.EdgeCount() << "ߣķ֧" << largest << "" << endl;
+    }
 }
\ No newline at end of file
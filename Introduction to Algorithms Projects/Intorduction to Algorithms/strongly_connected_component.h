@@ -0,0 +1,608 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		strongly_connected_component.h
+/// @brief		ǿ֧ͨʱTarjan㷨޻ͼԼеǰ㷨
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "graphics.h"
+#include "deapth_first_search.h"
+#include "parallel_for.h"
+
+using namespace std;
+
+namespace ita
+{
+    /// @brief Tarjanǿ֧ͨ㷨
+    ///
+    /// ֻҪGһȱȲҪG^TҲҪf
+    /// - index[u]ΪuֵĴlow[u]ΪuһϵıܵġջеĶСindex
+    /// - 㱻ʱѹһջuʱlow[u] == index[u]uһǿ֧ͨĸջuϣuĶ֧
+    ///
+    /// ȱʹDFS_Visitͬʽջ֡ʱΪO(V+E)ͼֻʹO(V)Ķռ䡣\n
+    /// Tarjan㷨ͼ򣨻ȣõ֧ѱŷ
+    /// ǶκһԽ֧ı(u, v)component[u] < component[v]֧ıűͼһ
+    /// @param	g				ͼGraphicsViaAdjacencyListGraphicsViaCompressedSparseRowͼǿ֧֧ͨͨ
+    /// @param	component		㷨component[i]Ϊiڵǿ֧ͨıţ0ʼ
+    /// @return					ǿ֧ͨĸ
+    template<typename GraphType>
+    size_t TarjanStronglyConnectedComponent( GraphType const &g, vector<int> &component )
+    {
+        size_t const n = g.GetVertex().size();
+        component.assign( n, -1 );						//-1ʾûйĳ֧index[v] != 0һʾvջ
+        vector<size_t> index( n, 0 );
+        vector<size_t> low( n, 0 );
+        vector<size_t> members;							//ûйĳ֧ѷֵĶ
+        vector<detail::_DFSFrame<GraphType>> stack;
+        size_t counter = 0;
+        size_t count = 0;
+
+        for ( size_t root = 0; root < n; ++root )
+        {
+            if ( index[root] != 0 )
+            {
+                continue;
+            }
+
+            index[root] = low[root] = ++counter;
+            members.push_back( root );
+            detail::_DFSFrame<GraphType> first = { root, g.AdjacentBegin( root ) };
+            stack.push_back( first );
+
+            while ( !stack.empty() )
+            {
+                size_t top = stack.size() - 1;
+                size_t u = stack[top].Vertex;
+                if ( stack[top].Next != g.AdjacentEnd( u ) )
+                {
+                    size_t v = stack[top].Next->AimNodeIndex;
+                    ++stack[top].Next;
+                    if ( index[v] == 0 )
+                    {
+                        index[v] = low[v] = ++counter;
+                        members.push_back( v );
+                        detail::_DFSFrame<GraphType> frame = { v, g.AdjacentBegin( v ) };
+                        stack.push_back( frame );
+                    }
+                    else if ( component[v] < 0 )
+                    {
+                        low[u] = min( low[u], index[v] );
+                    }
+                    continue;
+                }
+
+                //uڽӱ
+                stack.pop_back();
+                if ( low[u] == index[u] )
+                {
+                    size_t w;
+                    do
+                    {
+                        w = members.back();
+                        members.pop_back();
+                        component[w] = static_cast<int>( count );
+                    } while ( w != u );
+                    ++count;
+                }
+                if ( !stack.empty() )
+                {
+                    size_t parent = stack.back().Vertex;
+                    low[parent] = min( low[parent], low[u] );
+                }
+            }
+        }
+
+        // -> 
+        for ( size_t i = 0; i < n; ++i )
+        {
+            component[i] = static_cast<int>( count ) - 1 - component[i];
+        }
+        return count;
+    }
+
+    /// @brief ͼÿǿ֧ͨһõ޻ͼ
+    ///
+    /// CSRʽÿ֧ĶԼĺ̷֧ÿһԷ֧֮һߣ֧ڲı߱ȥ\n
+    /// ʱȰ֧ŶԶһμȻɨÿ֧еĶĳߣ
+    /// áһαĸ֧¼ıȥظıߣʱռ䶼O(V+E)
+    /// ֧TarjanStronglyConnectedComponentõʱÿ߶ӱСķָ֧Ŵķ֧
+    class CondensationGraph
+    {
+    public:
+        /// ֧Ķߺ̷֧ĵ
+        typedef size_t const *		Iterator;
+
+        /// @brief ͼԼǿ֧ͨͼ
+        ///
+        /// @param	g				ԭͼ
+        /// @param	component		component[i]Ϊiڵǿ֧ͨı
+        /// @param	count			ǿ֧ͨĸ
+        template<typename GraphType>
+        CondensationGraph( GraphType const &g, vector<int> const &component, size_t count )
+            : _member_offsets( count + 1, 0 ), _successor_offsets( count + 1, 0 )
+        {
+            size_t const n = g.GetVertex().size();
+
+            //֧ŶԶ
+            for ( size_t i = 0; i < n; ++i )
+            {
+                ++_member_offsets[component[i] + 1];
+            }
+            for ( size_t c = 0; c < count; ++c )
+            {
+                _member_offsets[c + 1] += _member_offsets[c];
+            }
+            _members.resize( n );
+            vector<size_t> next( _member_offsets.begin(), _member_offsets.end() - 1 );
+            for ( size_t i = 0; i < n; ++i )
+            {
+                _members[next[component[i]]++] = i;
+            }
+
+            //֧ռ̷֧marker[d] == cʾ֧cѾ¼d
+            vector<size_t> marker( count, count );
+            for ( size_t c = 0; c < count; ++c )
+            {
+                for ( size_t k = _member_offsets[c]; k < _member_offsets[c + 1]; ++k )
+                {
+                    size_t u = _members[k];
+                    for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+                    {
+                        size_t d = static_cast<size_t>( component[it->AimNodeIndex] );
+                        if ( d != c && marker[d] != c )
+                        {
+                            marker[d] = c;
+                            _successors.push_back( d );
+                        }
+                    }
+                }
+                _successor_offsets[c + 1] = _successors.size();
+            }
+        }
+
+        /// ֧ͼĶ㣩ĸ
+        inline size_t ComponentCount() const
+        {
+            return _member_offsets.size() - 1;
+        }
+
+        /// ͼı
+        inline size_t EdgeCount() const
+        {
+            return _successors.size();
+        }
+
+        /// ֧cĶ
+        inline size_t ComponentSize( size_t c ) const
+        {
+            return _member_offsets[c + 1] - _member_offsets[c];
+        }
+
+        /// ֧cĵһ㣬ͬһ֧еĶ㰴ŴС
+        inline Iterator MemberBegin( size_t c ) const
+        {
+            return _members.data() + _member_offsets[c];
+        }
+
+        /// ֧cһ֮λ
+        inline Iterator MemberEnd( size_t c ) const
+        {
+            return _members.data() + _member_offsets[c + 1];
+        }
+
+        /// ֧cĵһ̷֧
+        inline Iterator SuccessorBegin( size_t c ) const
+        {
+            return _successors.data() + _successor_offsets[c];
+        }
+
+        /// ֧cһ̷֧֮λ
+        inline Iterator SuccessorEnd( size_t c ) const
+        {
+            return _successors.data() + _successor_offsets[c + 1];
+        }
+
+    private:
+        vector<size_t>			_member_offsets;		///< ֧cĶλ_members[_member_offsets[c], _member_offsets[c + 1])
+        vector<size_t>			_members;				///< ֧еж
+        vector<size_t>			_successor_offsets;		///< ֧cĺλ_successors[_successor_offsets[c], _successor_offsets[c + 1])
+        vector<size_t>			_successors;			///< з֧ĺ̷֧
+    };
+
+    namespace detail
+    {
+        /// Ѿĳǿ֧ͨĶɫ
+        inline size_t _SCCAssigned()
+        {
+            return static_cast<size_t>( -1 );
+        }
+
+        /// @brief ǰ㷨Ĺ״̬
+        ///
+        /// ÿֽĻһɫʶɫͬĶͬһ֣֮以ཻ
+        /// ÿComponentInDegreeOutDegreeֻᱻڵĻֵǸд
+        /// ɫԭӵģΪʱ֣ڱɫھӵɫ
+        template<typename GraphType>
+        struct _FWBWState
+        {
+            GraphType const					&Graph;
+            ReverseAdjacency const			&Reverse;
+            vector<int>						&Component;
+            unique_ptr<atomic<size_t>[]>	Color;				///< ڵĻ֣_SCCAssigned()ʾѾĳ֧
+            unique_ptr<atomic<size_t>[]>	InDegree;			///< ޼ʱڻڵ
+            unique_ptr<atomic<size_t>[]>	OutDegree;			///< ޼ʱڻڵĳ
+            atomic<size_t>					NextColor;			///< һδʹõɫ
+            atomic<int>						NextComponent;		///< һδʹõķ֧
+
+            _FWBWState( GraphType const &g, ReverseAdjacency const &reverse, vector<int> &component )
+                : Graph( g ), Reverse( reverse ), Component( component ), Color( new atomic<size_t>[g.GetVertex().size()] ),
+                  InDegree( new atomic<size_t>[g.GetVertex().size()] ), OutDegree( new atomic<size_t>[g.GetVertex().size()] ), NextColor( 1 ), NextComponent( 0 )
+            {
+                for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+                {
+                    Color[i].store( 0, memory_order_relaxed );
+                }
+            }
+        };
+
+        /// Ѷ߳˽еһǰغϲһ
+        inline void _GatherFrontier( vector<vector<size_t>> &parts, vector<size_t> &frontier )
+        {
+            frontier.clear();
+            for ( size_t i = 0; i < parts.size(); ++i )
+            {
+                frontier.insert( frontier.end(), parts[i].begin(), parts[i].end() );
+                parts[i].clear();
+            }
+        }
+
+        /// @brief frontierͬ
+        ///
+        /// سߣbackwardΪfalseߣbackwardΪtrueչclaim( v )trueʾvɱεռĶ㣬
+        /// ᱻһ㣻claimԭӲ֤ÿֻռһΡ
+        template<typename GraphType, typename Claim>
+        void _SCCSearch( _FWBWState<GraphType> &state, vector<size_t> &frontier, bool backward, size_t thread_count, Claim claim )
+        {
+            vector<vector<size_t>> parts( thread_count );
+            while ( !frontier.empty() )
+            {
+                ParallelFor( frontier.size(), 64, thread_count, [&]( size_t worker, size_t begin, size_t end )
+                {
+                    vector<size_t> &next = parts[worker];
+                    for ( size_t i = begin; i < end; ++i )
+                    {
+                        size_t u = frontier[i];
+                        if ( backward )
+                        {
+                            for ( auto it = state.Reverse.PredecessorBegin( u ); it != state.Reverse.PredecessorEnd( u ); ++it )
+                            {
+                                if ( claim( *it ) )
+                                {
+                                    next.push_back( *it );
+                                }
+                            }
+                        }
+                        else
+                        {
+                            for ( auto it = state.Graph.AdjacentBegin( u ); it != state.Graph.AdjacentEnd( u ); ++it )
+                            {
+                                if ( claim( it->AimNodeIndex ) )
+                                {
+                                    next.push_back( it->AimNodeIndex );
+                                }
+                            }
+                        }
+                    }
+                } );
+                _GatherFrontier( parts, frontier );
+            }
+        }
+
+        /// @brief ޼Ȼ߳Ϊ0ĶԼһǿ֧ͨ
+        ///
+        /// ͳÿڻڵȣԻȻKahnɾΪ0Ķ㣬
+        /// ÿɾһͰĺ̵ȡǰĳȼ1ȽΪ0ھӽһ㡣еĹO(ֵĶ+)
+        /// @return	޼֮ʣµĶ
+        template<typename GraphType>
+        vector<size_t> _SCCTrim( _FWBWState<GraphType> &state, vector<size_t> const &members, size_t color, size_t thread_count )
+        {
+            size_t const grain = 1024;
+            auto in_partition = [&]( size_t v )
+            {
+                return state.Color[v].load( memory_order_relaxed ) == color;
+            };
+            //vɫcolorΪ_SCCAssigned()ɹʱΪһ֧
+            auto remove = [&]( size_t v ) -> bool
+            {
+                size_t expected = color;
+                if ( !state.Color[v].compare_exchange_strong( expected, _SCCAssigned(), memory_order_relaxed ) )
+                {
+                    return false;
+                }
+                state.Component[v] = state.NextComponent++;
+                return true;
+            };
+
+            //ͳƶʱûж㱻ɾ֮ÿǡñһ
+            ParallelFor( members.size(), grain, thread_count, [&]( size_t, size_t begin, size_t end )
+            {
+                for ( size_t i = begin; i < end; ++i )
+                {
+                    size_t v = members[i];
+                    size_t in = 0, out = 0;
+                    for ( auto it = state.Graph.AdjacentBegin( v ); it != state.Graph.AdjacentEnd( v ); ++it )
+                    {
+                        out += ( it->AimNodeIndex != v && in_partition( it->AimNodeIndex ) );
+                    }
+                    for ( auto it = state.Reverse.PredecessorBegin( v ); it != state.Reverse.PredecessorEnd( v ); ++it )
+                    {
+                        in += ( *it != v && in_partition( *it ) );
+                    }
+                    state.InDegree[v].store( in, memory_order_relaxed );
+                    state.OutDegree[v].store( out, memory_order_relaxed );
+                }
+            } );
+
+            vector<vector<size_t>> parts( thread_count );
+            ParallelFor( members.size(), grain, thread_count, [&]( size_t worker, size_t begin, size_t end )
+            {
+                for ( size_t i = begin; i < end; ++i )
+                {
+                    size_t v = members[i];
+                    if ( ( state.InDegree[v].load( memory_order_relaxed ) == 0 || state.OutDegree[v].load( memory_order_relaxed ) == 0 ) && remove( v ) )
+                    {
+                        parts[worker].push_back( v );
+                    }
+                }
+            } );
+
+            vector<size_t> frontier;
+            _GatherFrontier( parts, frontier );
+            while ( !frontier.empty() )
+            {
+                ParallelFor( frontier.size(), 64, thread_count, [&]( size_t worker, size_t begin, size_t end )
+                {
+                    for ( size_t i = begin; i < end; ++i )
+                    {
+                        size_t v = frontier[i];
+                        for ( auto it = state.Graph.AdjacentBegin( v ); it != state.Graph.AdjacentEnd( v ); ++it )
+                        {
+                            size_t w = it->AimNodeIndex;
+                            if ( w != v && in_partition( w ) && state.InDegree[w].fetch_sub( 1, memory_order_relaxed ) == 1 && remove( w ) )
+                            {
+                                parts[worker].push_back( w );
+                            }
+                        }
+                        for ( auto it = state.Reverse.PredecessorBegin( v ); it != state.Reverse.PredecessorEnd( v ); ++it )
+                        {
+                            size_t w = *it;
+                            if ( w != v && in_partition( w ) && state.OutDegree[w].fetch_sub( 1, memory_order_relaxed ) == 1 && remove( w ) )
+                            {
+                                parts[worker].push_back( w );
+                            }
+                        }
+                    }
+                } );
+                _GatherFrontier( parts, frontier );
+            }
+
+            vector<size_t> rest;
+            for ( size_t i = 0; i < members.size(); ++i )
+            {
+                if ( in_partition( members[i] ) )
+                {
+                    rest.push_back( members[i] );
+                }
+            }
+            return rest;
+        }
+
+        /// ֽһ
+        struct _SCCTask
+        {
+            size_t			Color;			///< ֵɫ
+            vector<size_t>	Members;		///< еĶ
+        };
+
+        /// @brief ֽһ֣޼Ȼһ֧ǰ
+        ///
+        /// ֧ڵǿ֧ͨǰɴＯFWɴＯBWĽĶֳֻFWеġֻBWеʣµ֣
+        /// κǿ֧ͨһ棬ǻأΪµtasks
+        template<typename GraphType>
+        void _SCCDecompose( _FWBWState<GraphType> &state, _SCCTask const &task, size_t thread_count, vector<_SCCTask> &tasks )
+        {
+            size_t const color = task.Color;
+            vector<size_t> members = _SCCTrim( state, task.Members, color, thread_count );
+            if ( members.empty() )
+            {
+                return;
+            }
+
+            //޼֮֮Ķķ֧
+            size_t pivot = members[0];
+            size_t best = 0;
+            for ( size_t i = 0; i < members.size(); ++i )
+            {
+                size_t v = members[i];
+                size_t weight = ( state.InDegree[v].load( memory_order_relaxed ) + 1 ) * ( state.OutDegree[v].load( memory_order_relaxed ) + 1 );
+                if ( weight > best )
+                {
+                    best = weight;
+                    pivot = v;
+                }
+            }
+
+            size_t const forward_color = state.NextColor++;
+            size_t const backward_color = state.NextColor++;
+            int const id = state.NextComponent++;
+
+            //ǰcolor -> forward_color
+            state.Color[pivot].store( forward_color, memory_order_relaxed );
+            vector<size_t> frontier( 1, pivot );
+            _SCCSearch( state, frontier, false, thread_count, [&]( size_t v ) -> bool
+            {
+                size_t expected = color;
+                return state.Color[v].compare_exchange_strong( expected, forward_color, memory_order_relaxed );
+            } );
+
+            //forward_color -> ֧ڵķ֧color -> backward_color
+            state.Color[pivot].store( _SCCAssigned(), memory_order_relaxed );
+            state.Component[pivot] = id;
+            frontier.assign( 1, pivot );
+            _SCCSearch( state, frontier, true, thread_count, [&]( size_t v ) -> bool
+            {
+                size_t expected = forward_color;
+                if ( state.Color[v].compare_exchange_strong( expected, _SCCAssigned(), memory_order_relaxed ) )
+                {
+                    state.Component[v] = id;
+                    return true;
+                }
+                expected = color;
+                return state.Color[v].compare_exchange_strong( expected, backward_color, memory_order_relaxed );
+            } );
+
+            _SCCTask parts[3];
+            parts[0].Color = forward_color;
+            parts[1].Color = backward_color;
+            parts[2].Color = color;
+            for ( size_t i = 0; i < members.size(); ++i )
+            {
+                size_t c = state.Color[members[i]].load( memory_order_relaxed );
+                for ( int k = 0; k < 3; ++k )
+                {
+                    if ( c == parts[k].Color )
+                    {
+                        parts[k].Members.push_back( members[i] );
+                    }
+                }
+            }
+            for ( int k = 0; k < 3; ++k )
+            {
+                if ( !parts[k].Members.empty() )
+                {
+                    tasks.push_back( _SCCTask() );
+                    tasks.back().Color = parts[k].Color;
+                    tasks.back().Members.swap( parts[k].Members );
+                }
+            }
+        }
+    }
+
+    /// @brief еǿֽ֧ͨ⣺޼ǰFW-BW㷨
+    ///
+    /// Tarjan㷨ȱĴ򣬱Ǵеġǰ㷨ֻҪɴԣ
+    /// ȡһ֧ppسܵĶ㼯FWܵĶ㼯BWĽpڵǿ֧ͨ
+    /// ĶֳֻFWеġֻBWеʣµ֣κǿ֧ͨԽǣֿԸԶصݹֽ⡣\n
+    /// ʵʵͼоǿֻ֧ͨһ㣬ǰȥǴ̫ߣÿηֽ֮ǰ޼
+    /// Ȼ߳Ϊ0ĶԼһ֧ɾȥֲ֮µĶ㡣\n
+    /// ֳ׶Σ
+    /// - һ׶ֻͼһ֣޼ǰǰͬģÿһthread_count̲߳еչݲУ
+    ///   һ֧ѡ޼֮֮Ķ㣬ͨķ֧У
+    /// - ڶ׶ʣµ໥صС֣ÿһthread_count̴߳ӹջȡ񲢴еطֽ⣬
+    ///   ֽ»ٷŻջУУ
+    ///
+    /// ֧ıǰҵȺģTarjan㷨ͬǲͼ
+    /// @param	g				ͼGraphicsViaAdjacencyListGraphicsViaCompressedSparseRow
+    /// @param	component		㷨component[i]Ϊiڵǿ֧ͨıţ0ʼ
+    /// @param	thread_count	̵߳ĸ
+    /// @param	reverse_view	ڽͼΪգʱʱһ
+    /// @return					ǿ֧ͨĸ
+    /// @see	TarjanStronglyConnectedComponent
+    template<typename GraphType>
+    size_t ParallelStronglyConnectedComponent( GraphType const &g, vector<int> &component, size_t thread_count = thread::hardware_concurrency(), ReverseAdjacency const *reverse_view = nullptr )
+    {
+        size_t const n = g.GetVertex().size();
+        thread_count = max( thread_count, static_cast<size_t>( 1 ) );
+        component.assign( n, -1 );
+
+        unique_ptr<ReverseAdjacency> own_reverse;
+        if ( !reverse_view )
+        {
+            own_reverse.reset( new ReverseAdjacency( g ) );
+            reverse_view = own_reverse.get();
+        }
+        detail::_FWBWState<GraphType> state( g, *reverse_view, component );
+
+        //һ׶ΣͼΪһ֣ݲ
+        vector<detail::_SCCTask> tasks;
+        detail::_SCCTask all;
+        all.Color = 0;
+        all.Members.resize( n );
+        for ( size_t i = 0; i < n; ++i )
+        {
+            all.Members[i] = i;
+        }
+        detail::_SCCDecompose( state, all, thread_count, tasks );
+        all.Members.clear();
+
+        //ڶ׶ΣÿһջΪղû߳ڷֽʱ
+        mutex lock;
+        condition_variable changed;
+        size_t active = 0;
+        auto worker = [&]()
+        {
+            vector<detail::_SCCTask> created;
+            unique_lock<mutex> guard( lock );
+            while ( true )
+            {
+                changed.wait( guard, [&]()
+                {
+                    return !tasks.empty() || active == 0;
+                } );
+                if ( tasks.empty() )
+                {
+                    break;
+                }
+
+                detail::_SCCTask task;
+                task.Color = tasks.back().Color;
+                task.Members.swap( tasks.back().Members );
+                tasks.pop_back();
+                ++active;
+                guard.unlock();
+
+                detail::_SCCDecompose( state, task, 1, created );
+
+                guard.lock();
+                for ( size_t i = 0; i < created.size(); ++i )
+                {
+                    tasks.push_back( detail::_SCCTask() );
+                    tasks.back().Color = created[i].Color;
+                    tasks.back().Members.swap( created[i].Members );
+                }
+                created.clear();
+                --active;
+                changed.notify_all();
+            }
+        };
+
+        vector<thread> threads;
+        for ( size_t i = 1; i < thread_count; ++i )
+        {
+            threads.push_back( thread( worker ) );
+        }
+        worker();
+        for ( size_t i = 0; i < threads.size(); ++i )
+        {
+            threads[i].join();
+        }
+
+        return static_cast<size_t>( state.NextComponent.load() );
+    }
+}
\ No newline at end of file
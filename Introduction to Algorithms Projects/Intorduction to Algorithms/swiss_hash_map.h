@@ -0,0 +1,325 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		swiss_hash_map.h
+/// @brief		Կֽڷ̽ĿѰַɢбSwiss tableʹSSE2һαȽ16
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdint>
+#include "universal_hash.h"
+
+#if defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 ) || defined(__SSE2__)
+#define ITA_SWISS_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace ita
+{
+    /// @brief Կֽڷ̽ĿѰַɢбSwiss table
+    ///
+    /// UniversalHashTableSearchҪرȽϣÿһһԤķô棻ʧʱ\n
+    /// SwissHashMapΪÿⱣһֽڵĿϢпֽڴһУÿ16Ϊһ飺
+    /// - ղΪEmpty0x80ɾĲΪDeleted0xFEԪصĲΪɢֵĵ7λH2λΪ0
+    /// - ɢֵಿH1һ鿪ʼ̽飬֮ö̽飨1, 2, 3, ...飩
+    /// - ̽һʱһSSE2ֽڱȽָ16ֽͬʱH2ȽϣֻH2ͬԼ1/128Ĳ۲ҪȽϹؼ֣
+    ///   ֻҪһлEmpty˵ؼֲڱУء
+    ///
+    /// ԲʧܵĴֻͨһ16ֽڵĶȡͱȽϣǳʺʧʸߵĲҡ\n
+    /// ɾʱڵлEmpty˵û̽Խһ飬ֱΪEmptyֻΪDeleted
+    /// DeletedԪһװأװس7/8ʱɢУԪضʱ۵ĸֻԭDeleted\n
+    /// ûSSE2ƽ̨˻ΪֽڱȽϣȫͬ
+    /// @param	KeyType		ؼֵͣǲ64λ
+    /// @param	ValueType	ֵ
+    /// @see	class UniversalHashTable
+    /// @see	class RobinHoodHashMap
+    template<typename KeyType, typename ValueType>
+    class SwissHashMap
+    {
+    public:
+        /// һյɢб۵ĸΪinitial_capacityͬʱȫɢкѡһɢк
+        explicit SwissHashMap( size_t initial_capacity = 16 ) : _size( 0 ), _deleted( 0 )
+        {
+            size_t capacity = _GroupSize();
+            while ( capacity < initial_capacity )
+            {
+                capacity *= 2;
+            }
+            _Resize( capacity );
+        }
+
+        /// @brief һԪ
+        ///
+        /// @return	trueʾµԪأfalseʾؼѾڣֵֻ
+        bool Insert( KeyType const &key, ValueType const &value )
+        {
+            uint64_t hash = _hash( static_cast<uint64_t>( key ) );
+            size_t pos = _Find( key, hash );
+            if ( pos != _NotFound() )
+            {
+                _values[pos] = value;
+                return false;
+            }
+
+            if ( _size + _deleted + 1 > _GrowthLimit() )
+            {
+                //Deletedռ˴ʱԭɢо͹
+                _Rehash( _size + 1 > _GrowthLimit() / 2 ? Capacity() * 2 : Capacity() );
+            }
+
+            pos = _FindInsertSlot( hash );
+            if ( _control[pos] == _Deleted() )
+            {
+                --_deleted;
+            }
+            _control[pos] = _H2( hash );
+            _keys[pos] = key;
+            _values[pos] = value;
+            ++_size;
+            return true;
+        }
+
+        /// @brief ɾһԪ
+        ///
+        /// @return	ǷɹɾԪ
+        bool Delete( KeyType const &key )
+        {
+            size_t pos = _Find( key, _hash( static_cast<uint64_t>( key ) ) );
+            if ( pos == _NotFound() )
+            {
+                return false;
+            }
+
+            size_t group = pos & ~( _GroupSize() - 1 );
+            if ( _MatchByte( &_control[group], _Empty() ) )
+            {
+                _control[pos] = _Empty();
+            }
+            else
+            {
+                _control[pos] = _Deleted();
+                ++_deleted;
+            }
+            _values[pos] = ValueType();
+            --_size;
+            return true;
+        }
+
+        /// ɢбһԪأֵָ룬Ҳʱnullptr
+        ValueType * Search( KeyType const &key )
+        {
+            size_t pos = _Find( key, _hash( static_cast<uint64_t>( key ) ) );
+            return pos == _NotFound() ? nullptr : &_values[pos];
+        }
+
+        /// Ԫصĸ
+        size_t Size() const
+        {
+            return _size;
+        }
+
+        /// ۵ĸ
+        size_t Capacity() const
+        {
+            return _control.size();
+        }
+
+        /// ɢбееԪʾ
+        void Display() const
+        {
+            for ( size_t i = 0; i < Capacity(); ++i )
+            {
+                cout << "[" << setw( 3 ) << i << setw( 3 ) << "]";
+                if ( _control[i] == _Deleted() )
+                {
+                    cout << " (ɾ)";
+                }
+                else if ( _control[i] != _Empty() )
+                {
+                    cout << " " << _keys[i] << " -> " << _values[i] << " (H2 = " << static_cast<int>( _control[i] ) << ")";
+                }
+                cout << endl;
+            }
+        }
+
+    private:
+        static size_t _GroupSize()
+        {
+            return 16;
+        }
+
+        static int8_t _Empty()
+        {
+            return static_cast<int8_t>( 0x80 );
+        }
+
+        static int8_t _Deleted()
+        {
+            return static_cast<int8_t>( 0xFE );
+        }
+
+        static size_t _NotFound()
+        {
+            return static_cast<size_t>( -1 );
+        }
+
+        /// ɢֵĵ7λڿֽ
+        static int8_t _H2( uint64_t hash )
+        {
+            return static_cast<int8_t>( hash & 0x7F );
+        }
+
+        /// ɢֵಿ֣̽ʼ
+        static size_t _H1( uint64_t hash )
+        {
+            return static_cast<size_t>( hash >> 7 );
+        }
+
+        /// һ16ֽеbЩλɵλ
+        static uint32_t _MatchByte( int8_t const *group, int8_t b )
+        {
+#ifdef ITA_SWISS_HASH_MAP_SSE2
+            __m128i ctrl = _mm_loadu_si128( reinterpret_cast<__m128i const *>( group ) );
+            return static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( ctrl, _mm_set1_epi8( b ) ) ) );
+#else
+            uint32_t mask = 0;
+            for ( size_t i = 0; i < _GroupSize(); ++i )
+            {
+                mask |= static_cast<uint32_t>( group[i] == b ) << i;
+            }
+            return mask;
+#endif
+        }
+
+        /// һ16ֽEmptyDeletedλΪ1Щλɵλ
+        static uint32_t _MatchEmptyOrDeleted( int8_t const *group )
+        {
+#ifdef ITA_SWISS_HASH_MAP_SSE2
+            return static_cast<uint32_t>( _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const *>( group ) ) ) );
+#else
+            uint32_t mask = 0;
+            for ( size_t i = 0; i < _GroupSize(); ++i )
+            {
+                mask |= static_cast<uint32_t>( group[i] < 0 ) << i;
+            }
+            return mask;
+#endif
+        }
+
+        /// λ͵1ڵλãҪmask != 0
+        static size_t _LowestBit( uint32_t mask )
+        {
+#ifdef _MSC_VER
+            unsigned long index;
+            _BitScanForward( &index, mask );
+            return index;
+#else
+            return static_cast<size_t>( __builtin_ctz( mask ) );
+#endif
+        }
+
+        /// ɵԪDeleted
+        size_t _GrowthLimit() const
+        {
+            return Capacity() - Capacity() / 8;
+        }
+
+        /// ҹؼڵĲ
+        size_t _Find( KeyType const &key, uint64_t hash ) const
+        {
+            size_t group_mask = Capacity() / _GroupSize() - 1;
+            size_t group = _H1( hash ) & group_mask;
+            int8_t h2 = _H2( hash );
+            for ( size_t step = 1; ; ++step )
+            {
+                int8_t const *ctrl = &_control[group * _GroupSize()];
+                for ( uint32_t match = _MatchByte( ctrl, h2 ); match; match &= match - 1 )
+                {
+                    size_t pos = group * _GroupSize() + _LowestBit( match );
+                    if ( _keys[pos] == key )
+                    {
+                        return pos;
+                    }
+                }
+                //һлпղۣؼִڣʱͻᱻһ
+                if ( _MatchByte( ctrl, _Empty() ) || step > group_mask )
+                {
+                    return _NotFound();
+                }
+                group = ( group + step ) & group_mask;
+            }
+        }
+
+        /// ̽ҵһEmptyDeletedĲ
+        size_t _FindInsertSlot( uint64_t hash ) const
+        {
+            size_t group_mask = Capacity() / _GroupSize() - 1;
+            size_t group = _H1( hash ) & group_mask;
+            for ( size_t step = 1; ; ++step )
+            {
+                uint32_t match = _MatchEmptyOrDeleted( &_control[group * _GroupSize()] );
+                if ( match )
+                {
+                    return group * _GroupSize() + _LowestBit( match );
+                }
+                group = ( group + step ) & group_mask;
+            }
+        }
+
+        void _Resize( size_t capacity )
+        {
+            _control.assign( capacity, _Empty() );
+            _keys.assign( capacity, KeyType() );
+            _values.assign( capacity, ValueType() );
+        }
+
+        /// еԪɢеcapacityУͬʱеDeleted
+        void _Rehash( size_t capacity )
+        {
+            vector<int8_t> old_control;
+            vector<KeyType> old_keys;
+            vector<ValueType> old_values;
+            old_control.swap( _control );
+            old_keys.swap( _keys );
+            old_values.swap( _values );
+
+            _Resize( capacity );
+            for ( size_t i = 0; i < old_control.size(); ++i )
+            {
+                if ( old_control[i] >= 0 )
+                {
+                    uint64_t hash = _hash( static_cast<uint64_t>( old_keys[i] ) );
+                    size_t pos = _FindInsertSlot( hash );
+                    _control[pos] = _H2( hash );
+                    _keys[pos] = old_keys[i];
+                    _values[pos] = old_values[i];
+                }
+            }
+            _deleted = 0;
+        }
+
+        UniversalHashFunction	_hash;			///< ȫɢк
+        vector<int8_t>			_control;		///< ֽڣ۵ĸ16ı2
+        vector<KeyType>			_keys;			///< ؼ
+        vector<ValueType>		_values;		///< ֵ
+        size_t					_size;			///< Ԫصĸ
+        size_t					_deleted;		///< Deletedĸ
+    };
+}
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include <string>
 #include "graphics.h"
 #include "deapth_first_search.h"
+#include "topological_sort.h"
 
 using namespace std;
 
@@ -30,7 +31,7 @@ namespace ita
     /// @breif 
     ///
     /// ȱĻϣ޻·ͼֱСһޡݱõʱf[i]ͺˡ\n
-    /// Ķʱʱ෴˳֡·ǳʶǰʹõķöˣַڱֻҪһ򵥵sortʱ临ӶҲΪO(V+E)\n
+    /// Ķʱʱ෴˳֡·ǳʶǰʹõķöˣַڱͬʱɵȺ¶㣬sortҪʱ临ӶΪO(V+E)\n
     /// µķۻǣһԲͬĶu,vһu -> vıߣôuĽһvǰ档\n
     /// ָݺǶ׵Ķu -> vôf[v]<f[u]Ե֤fõ˳һΪ
     void TopologicalSort()
@@ -56,35 +57,71 @@ namespace ita
         g.Link2Vertex( 6, 8 );
         g.Link2Vertex( 7, 8 );
 
-        vector<int>		d( g.GetVertex().size() );				//ʱd
-        vector<int>		f( g.GetVertex().size() );				//ʱf
-        vector<bool>	traversed( g.GetVertex().size(), false );	//ʶǷѾ
-        int				time = 0;
-
-        for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+        //Ķʱ෴˳֣FinishVertexʱѶŵǰ棬ͲҪˡ
+        //гַ˵ͼл·ʱ
+        struct TopologicalVisitor : public DFSVisitor
         {
-            if ( !traversed[i] )
+            vector<size_t>	Finished;
+            bool			HasCycle;
+
+            TopologicalVisitor() : HasCycle( false )
+            {
+
+            }
+
+            void FinishVertex( size_t u, int )
             {
-                DFS_Visit( g, i, d, f, traversed, time );
+                Finished.push_back( u );
             }
+
+            void BackEdge( size_t, size_t )
+            {
+                HasCycle = true;
+            }
+        } visitor;
+
+        vector<int>		d;				//ʱd
+        vector<int>		f;				//ʱf
+        DFS( g, d, f, visitor );
+
+        if ( visitor.HasCycle )
+        {
+            cout << "ͼл·" << endl;
+            return;
         }
 
         cout << "" << endl;
-        vector<pair<int, pair<int, int>>> r;
-        for ( size_t i = 0; i < g.GetVertex().size(); ++i )
+        for ( size_t i = visitor.Finished.size(); i > 0; --i )
         {
-            r.push_back( make_pair( i, make_pair( d[i], f[i] ) ) );
+            size_t u = visitor.Finished[i - 1];
+            cout << g.GetVertex()[u] << "[" << d[u] << "," << f[u] << "]" << endl;
         }
-        //ʱfźĽĽ
-        sort( r.rbegin(), r.rend(), []( pair<int, pair<int, int>> const & p1, pair<int, pair<int, int>> const & p2 )
-        {
-            return p1.second.second < p2.second.second;
-        } );
-        for ( size_t i = 0; i < r.size(); ++i )
+
+        //Kahn㷨ͬһе·ͬʱ㹻ֵĻ
+        vector<size_t> order, level_offsets, cycle;
+        KahnTopologicalSort( g, order, level_offsets, cycle );
+        cout << "" << endl;
+        for ( size_t k = 0; k + 1 < level_offsets.size(); ++k )
         {
-            cout << g.GetVertex()[r[i].first] << "[" << r[i].second.first << "," << r[i].second.second << "]" << endl;
+            cout << "" << k << "㣺";
+            for ( size_t i = level_offsets[k]; i < level_offsets[k + 1]; ++i )
+            {
+                cout << g.GetVertex()[order[i]] << " ";
+            }
+            cout << endl;
         }
 
+        //һjacket -> pantsı֮˻·pants -> belt -> jacket -> pants
+        g.Link2Vertex( 8, 3 );
+        if ( !KahnTopologicalSort( g, order, level_offsets, cycle ) )
+        {
+            cout << "ͼл·";
+            for ( size_t i = 0; i < cycle.size(); ++i )
+            {
+                cout << g.GetVertex()[cycle[i]] << " -> ";
+            }
+            cout << g.GetVertex()[cycle[0]] << endl;
+        }
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		topological_sort.h
+/// @brief		ȵKahn㷨ԲִеĶ
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <vector>
+#include <algorithm>
+#include "graphics.h"
+
+using namespace std;
+
+namespace ita
+{
+    /// @brief ȵKahn㷨ͬʱѶ㻮Ϊһһķ
+    ///
+    /// ͳÿȣΪ0Ķɵ0㣻ɾkж㣨ǵĺ̵ȼ1֮
+    /// ȽΪ0Ķɵk+1㡣ÿڵĲǴĳԴ㵽·ı
+    /// ͬһеĶ֮û·ͬһͬʱִУ֮һϡ
+    /// ·ϵĶ޶ʱҪٵĲ\n
+    /// ÿֻһΣʱΪO(V+E)\n
+    /// л·ʱ·ϵĶԶήΪ0ɾʣ¶㡣ʣµÿ㶼һʣµǰ
+    /// ԴκһʣµĶһʣµǰȻص߹ĳ㣬ɴ˵õһ·ߣ
+    /// ǸһֻʱҪ췴ڽͼ
+    /// @param	g				ͼGraphicsViaAdjacencyListGraphicsViaCompressedSparseRow
+    /// @param	order			㷨Ϊл·ʱֻڻ·ϡҲڻ·֮Щ
+    /// @param	level_offsets	㷨kΪorder[level_offsets[k], level_offsets[k + 1])䣬в+1
+    /// @param	cycle			л·ʱΪһ·ϵĶ㣬ߵķУһһ߻صһ㣻޻·ʱΪ
+    /// @return					ͼǷ޻·Ƿ
+    template<typename GraphType>
+    bool KahnTopologicalSort( GraphType const &g, vector<size_t> &order, vector<size_t> &level_offsets, vector<size_t> &cycle )
+    {
+        size_t const n = g.GetVertex().size();
+        vector<size_t> in_degree( n, 0 );
+        for ( size_t u = 0; u < n; ++u )
+        {
+            for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+            {
+                ++in_degree[it->AimNodeIndex];
+            }
+        }
+
+        order.clear();
+        order.reserve( n );
+        level_offsets.assign( 1, 0 );
+        cycle.clear();
+        for ( size_t u = 0; u < n; ++u )
+        {
+            if ( in_degree[u] == 0 )
+            {
+                order.push_back( u );
+            }
+        }
+
+        //orderͬʱ䵱Уǰ[level_begin, level_end)µһֱ׷ں
+        size_t level_begin = 0;
+        while ( level_begin < order.size() )
+        {
+            size_t level_end = order.size();
+            level_offsets.push_back( level_end );
+            for ( size_t i = level_begin; i < level_end; ++i )
+            {
+                size_t u = order[i];
+                for ( auto it = g.AdjacentBegin( u ); it != g.AdjacentEnd( u ); ++it )
+                {
+                    if ( --in_degree[it->AimNodeIndex] == 0 )
+                    {
+                        order.push_back( it->AimNodeIndex );
+                    }
+                }
+            }
+            level_begin = level_end;
+        }
+
+        if ( order.size() == n )
+        {
+            return true;
+        }
+
+        //ʣµĶȶ0ʣµǰֱظ
+        ReverseAdjacency reverse( g );
+        vector<size_t> step( n, n );			//step[v]Ϊvڻ·еλãnʾûߵ
+        vector<size_t> path;
+        size_t v = 0;
+        while ( in_degree[v] == 0 )
+        {
+            ++v;
+        }
+        while ( step[v] == n )
+        {
+            step[v] = path.size();
+            path.push_back( v );
+            for ( auto it = reverse.PredecessorBegin( v ); it != reverse.PredecessorEnd( v ); ++it )
+            {
+                if ( in_degree[*it] != 0 )
+                {
+                    v = *it;
+                    break;
+                }
+            }
+        }
+
+        //path[step[v]...]űߵķ߳Ļ·
+        cycle.assign( path.rbegin(), path.rend() - step[v] );
+        return false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+/// @file		universal_hash.h
+/// @brief		64λؼֵȫɢк
+/// @details	COPYRIGHT NOTICE
+///			    Copyright (c) 2026
+///			    All rights reserved.\n
+///
+///
+/// @author		̷	chuanqi.tan(at)gmail.com
+/// @date		2026/10/17
+/// @version	1.0
+//////////////////////////////////////////////////////////////////////////
+/// ޸ļ¼
+/// 2026/10/17	1.0	̷	
+
+#include <cstdlib>
+#include <cstdint>
+
+namespace ita
+{
+    /// @brief 64λؼֵȫɢк
+    ///
+    /// hash_table.cppUniversalHashTableʹõͬһ庯h(a, b, k) = ((a*k + b) mod p)aZp*bZpabڹʱѡȡ\n
+    /// ͬUniversalHashTablep = 101ֱinta*k + bؼԴһͻ
+    /// pȡ÷ɭ2<sup>61</sup>-1a*k128λ˻32λƬ㣬2<sup>61</sup>  1 (mod p)۵
+    /// ˲Ҫ128λ֧֣Ҳ\n
+    /// [0, p)Уģϲ۵ĸmǲ۵ıţmΪ2ʱֱȡλɣ
+    /// @note	ؼģpԼ[0, p)Уģpͬؼ֣02<sup>61</sup>-1ײ
+    class UniversalHashFunction
+    {
+    public:
+        /// Ӻѡһɢк
+        UniversalHashFunction()
+        {
+            _a = _RandomBelow( _Prime() - 1 ) + 1;
+            _b = _RandomBelow( _Prime() );
+        }
+
+        /// (a*k + b) mod p
+        uint64_t operator()( uint64_t k ) const
+        {
+            return _Reduce( _MultiplyMod( _a, _Reduce( k ) ) + _b );
+        }
+
+    private:
+        /// p = 2^61 - 1
+        static uint64_t _Prime()
+        {
+            return ( static_cast<uint64_t>( 1 ) << 61 ) - 1;
+        }
+
+        /// xx < 2^64Լ[0, p)
+        static uint64_t _Reduce( uint64_t x )
+        {
+            x = ( x & _Prime() ) + ( x >> 61 );
+            return x >= _Prime() ? x - _Prime() : x;
+        }
+
+        /// @brief a*b mod pҪa, b < p
+        ///
+        /// a*b = hi*2^64 + mid*2^32 + lo2^64  8mid*2^32  (mid >> 29) + ((mid << 32) mod 2^61)
+        static uint64_t _MultiplyMod( uint64_t a, uint64_t b )
+        {
+            uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+            uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+
+            uint64_t lo = a_lo * b_lo;
+            uint64_t mid = a_lo * b_hi + a_hi * b_lo;
+            uint64_t hi = a_hi * b_hi;
+
+            uint64_t r = ( lo & _Prime() ) + ( lo >> 61 ) + ( hi << 3 ) + ( mid >> 29 ) + ( ( mid << 32 ) & _Prime() );
+            return _Reduce( r );
+        }
+
+        /// rand()ƴһ[0, bound)е
+        static uint64_t _RandomBelow( uint64_t bound )
+        {
+            uint64_t r = 0;
+            for ( int i = 0; i < 5; ++i )
+            {
+                r = ( r << 15 ) ^ static_cast<uint64_t>( rand() );
+            }
+            return r % bound;
+        }
+
+        uint64_t	_a;		///< Zp*
+        uint64_t	_b;		///< Zp
+    };
+}
\ No newline at end of file